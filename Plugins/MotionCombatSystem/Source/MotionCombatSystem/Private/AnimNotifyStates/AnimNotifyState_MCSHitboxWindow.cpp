@@ -0,0 +1,138 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * AnimNotifyState_MCSHitboxWindow.cpp
+ * Editor/cook-time trajectory baking for the hitbox window notify.
+ */
+
+#include <AnimNotifyStates/AnimNotifyState_MCSHitboxWindow.h>
+
+#if WITH_EDITOR
+#include "Animation/AnimMontage.h"
+#include "Animation/Skeleton.h"
+#include "Animation/AnimationPoseData.h"
+#include "Animation/AttributesRuntime.h"
+#include "BonePose.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "UObject/ObjectSaveContext.h"
+
+namespace MCS_HitboxBake
+{
+    /** Resolves a socket (skeleton, then preview mesh) or bone name to a skeleton bone and a bone-local offset */
+    static bool ResolveSocket(const USkeleton* Skeleton, FName SocketName, int32& OutBoneIndex, FTransform& OutLocal)
+    {
+        const USkeletalMeshSocket* Socket = Skeleton->FindSocket(SocketName);
+        if (!Socket)
+        {
+            if (const USkeletalMesh* PreviewMesh = Skeleton->GetPreviewMesh())
+            {
+                Socket = PreviewMesh->FindSocket(SocketName);
+            }
+        }
+
+        const FName BoneName = Socket ? Socket->BoneName : SocketName;
+        OutBoneIndex = Skeleton->GetReferenceSkeleton().FindBoneIndex(BoneName);
+        OutLocal = Socket ? FTransform(Socket->RelativeRotation, Socket->RelativeLocation, Socket->RelativeScale) : FTransform::Identity;
+        return OutBoneIndex != INDEX_NONE;
+    }
+}
+
+void UAnimNotifyState_MCSHitboxWindow::PreSave(FObjectPreSaveContext SaveContext)
+{
+    Super::PreSave(SaveContext);
+    BakeTrajectory();
+}
+
+void UAnimNotifyState_MCSHitboxWindow::BakeTrajectory()
+{
+    Hitbox.ClearBakedTrajectory();
+    if (!Hitbox.bBakeTrajectory)
+        return;
+
+    const UAnimMontage* Montage = GetTypedOuter<UAnimMontage>();
+    USkeleton* Skeleton = Montage ? Montage->GetSkeleton() : nullptr;
+    if (!Skeleton || Montage->SlotAnimTracks.IsEmpty())
+        return;
+
+    // Locate this window on the montage timeline
+    const FAnimNotifyEvent* Event = Montage->Notifies.FindByPredicate([ this ] (const FAnimNotifyEvent& Candidate)
+        {
+            return Candidate.NotifyStateClass == this;
+        });
+    if (!Event || Event->GetDuration() <= 0.0f)
+        return;
+
+    int32 StartBone = INDEX_NONE;
+    int32 EndBone = INDEX_NONE;
+    FTransform StartLocal, EndLocal;
+    if (!MCS_HitboxBake::ResolveSocket(Skeleton, Hitbox.StartSocket, StartBone, StartLocal) ||
+        !MCS_HitboxBake::ResolveSocket(Skeleton, Hitbox.EndSocket, EndBone, EndLocal))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_HitboxWindow] %s: cannot bake, sockets %s/%s not found on %s."),
+            *Montage->GetName(), *Hitbox.StartSocket.ToString(), *Hitbox.EndSocket.ToString(), *Skeleton->GetName());
+        return;
+    }
+
+    // Full-skeleton pose buffers
+    const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+    TArray<FBoneIndexType> RequiredBones;
+    RequiredBones.SetNumUninitialized(RefSkeleton.GetNum());
+    for (int32 BoneIndex = 0; BoneIndex < RequiredBones.Num(); ++BoneIndex)
+    {
+        RequiredBones[BoneIndex] = static_cast<FBoneIndexType>(BoneIndex);
+    }
+
+    FBoneContainer BoneContainer(RequiredBones, UE::Anim::FCurveFilterSettings(UE::Anim::ECurveFilterMode::DisallowAll), *Skeleton);
+    FCompactPose Pose;
+    Pose.SetBoneContainer(&BoneContainer);
+    FBlendedCurve Curve;
+    Curve.InitFrom(BoneContainer);
+    UE::Anim::FStackAttributeContainer Attributes;
+    FAnimationPoseData PoseData(Pose, Curve, Attributes);
+
+    const FCompactPoseBoneIndex StartCompact = BoneContainer.GetCompactPoseIndexFromSkeletonIndex(StartBone);
+    const FCompactPoseBoneIndex EndCompact = BoneContainer.GetCompactPoseIndexFromSkeletonIndex(EndBone);
+    const FCompactPoseBoneIndex RootCompact(0);
+
+    // Uniform samples covering the window, at least BakeSampleRate per second
+    const float Duration = Event->GetDuration();
+    const int32 NumSamples = FMath::Max(FMath::CeilToInt(Duration * FMath::Max(Hitbox.BakeSampleRate, 1.0f)) + 1, 2);
+    const float SampleInterval = Duration / (NumSamples - 1);
+    const FAnimTrack& Track = Montage->SlotAnimTracks[0].AnimTrack;
+
+    Hitbox.BakedStartPositions.Reserve(NumSamples);
+    Hitbox.BakedEndPositions.Reserve(NumSamples);
+
+    for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+    {
+        const double SampleTime = Event->GetTriggerTime() + SampleIndex * SampleInterval;
+        Track.GetAnimationPose(PoseData, FAnimExtractContext(SampleTime));
+
+        // Root motion is applied to the actor at runtime while the mesh root stays locked to the reference pose
+        if (Montage->HasRootMotion())
+        {
+            Pose[RootCompact] = RefSkeleton.GetRefBonePose()[0];
+        }
+
+        FCSPose<FCompactPose> ComponentPose;
+        ComponentPose.InitPose(Pose);
+
+        Hitbox.BakedStartPositions.Add(FVector3f((StartLocal * ComponentPose.GetComponentSpaceTransform(StartCompact)).GetLocation()));
+        Hitbox.BakedEndPositions.Add(FVector3f((EndLocal * ComponentPose.GetComponentSpaceTransform(EndCompact)).GetLocation()));
+    }
+
+    Hitbox.BakedWindowStart = Event->GetTriggerTime();
+    Hitbox.BakedSampleInterval = SampleInterval;
+}
+#endif
@@ -18,6 +18,9 @@
 #include "GameFramework/Actor.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Math/UnrealMathUtility.h"
+#include "Misc/ScopeExit.h"
+#include <Structs/MCS_TargetSnapshot.h>
+#include <AnimNotifyStates/AnimNotifyState_MCSHitboxWindow.h>
 
 UMCS_AttackChooser::UMCS_AttackChooser()
 {
@@ -50,6 +53,13 @@ bool UMCS_AttackChooser::ChooseAttack(
     ClearDebugScores();
 #endif
 
+    // Resolve target positions once; every entry below reuses them
+    BuildTargetCache(Instigator, Targets, TargetCache);
+    ON_SCOPE_EXIT
+    {
+        TargetCache.Reset();
+    };
+
     float BestScore = -TNumericLimits<float>::Max();
     TArray<int32> BestIndices;
 
@@ -203,27 +213,14 @@ float UMCS_AttackChooser::ComputeDistanceScore(const FMCS_AttackEntry& Entry, AA
     if (!Instigator || Targets.IsEmpty())
         return 0.f;
 
-    AActor* ClosestTarget = nullptr;
-    float ClosestDistSq = TNumericLimits<float>::Max();
-    const FVector InstigatorLoc = Instigator->GetActorLocation();
-
-    for (AActor* Target : Targets)
-    {
-        if (!IsValid(Target))
-            continue;
-
-        const float DistSq = FVector::DistSquared(InstigatorLoc, Target->GetActorLocation());
-        if (DistSq < ClosestDistSq)
-        {
-            ClosestDistSq = DistSq;
-            ClosestTarget = Target;
-        }
-    }
-
-    if (!ClosestTarget)
+    FMCS_ChooserTargetCache Scratch;
+    const FMCS_ChooserTargetCache& Cache = GetTargetCache(Instigator, Targets, Scratch);
+    if (Cache.TargetLocations.IsEmpty())
         return 0.f;
 
-    const float Dist = FMath::Sqrt(ClosestDistSq);
+    // Judge the range window where the closest target will be at impact, not where it is now
+    const float Lookahead = bPredictTargetMotion ? GetHitLookaheadTime(Entry) : 0.f;
+    const float Dist = Lookahead > 0.f ? GetPredictedClosestDistance(Cache, Lookahead) : FMath::Sqrt(Cache.ClosestDistSq);
     if (Dist < Entry.RangeStart)
         return -(Entry.RangeStart - Dist) * 0.1f;
 
@@ -371,32 +368,187 @@ bool UMCS_AttackChooser::IsEntryAllowedByBasicFilters(const FMCS_AttackEntry& En
     if (Targets.IsEmpty())
         return true;
 
-    const FVector InstigatorLoc = Instigator->GetActorLocation();
-    const FVector InstigatorForward = Instigator->GetActorForwardVector();
+    // The filter does not depend on the entry, so it is evaluated once per ChooseAttack
+    FMCS_ChooserTargetCache Scratch;
+    return GetTargetCache(Instigator, Targets, Scratch).bPassesBasicFilters;
+}
+
+/* ==========================================================
+ * Target Cache
+ * ==========================================================
+ */
+
+FVector UMCS_AttackChooser::ResolveTargetLocation(const AActor* Actor) const
+{
+    if (TargetSnapshot)
+    {
+        const int32 Slot = TargetSnapshot->FindSlot(Actor);
+        if (TargetSnapshot->IsSlotValid(Slot))
+            return TargetSnapshot->Locations[Slot];
+    }
+
+    return Actor->GetActorLocation();
+}
+
+FVector UMCS_AttackChooser::ResolveTargetVelocity(const AActor* Actor) const
+{
+    if (TargetSnapshot)
+    {
+        const int32 Slot = TargetSnapshot->FindSlot(Actor);
+        if (TargetSnapshot->IsSlotValid(Slot))
+            return TargetSnapshot->Velocities[Slot];
+    }
+
+    return Actor->GetVelocity();
+}
+
+float UMCS_AttackChooser::GetPredictedClosestDistance(const FMCS_ChooserTargetCache& Cache, float LookaheadTime)
+{
+    // Entries usually share a handful of hit timings, so most calls hit the memo
+    for (const FVector2f& Memo : Cache.LookaheadMemo)
+    {
+        if (Memo.X == LookaheadTime)
+            return Memo.Y;
+    }
 
-    for (AActor* Target : Targets)
+    // Branch-free loop over contiguous per-axis arrays so the compiler can vectorize it
+    const int32 Num = Cache.RelativeX.Num();
+    const float* RX = Cache.RelativeX.GetData();
+    const float* RY = Cache.RelativeY.GetData();
+    const float* RZ = Cache.RelativeZ.GetData();
+    const float* VX = Cache.VelocityX.GetData();
+    const float* VY = Cache.VelocityY.GetData();
+    const float* VZ = Cache.VelocityZ.GetData();
+
+    float ClosestDistSq = TNumericLimits<float>::Max();
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const float X = RX[i] + VX[i] * LookaheadTime;
+        const float Y = RY[i] + VY[i] * LookaheadTime;
+        const float Z = RZ[i] + VZ[i] * LookaheadTime;
+        ClosestDistSq = FMath::Min(ClosestDistSq, X * X + Y * Y + Z * Z);
+    }
+
+    const float Closest = FMath::Sqrt(ClosestDistSq);
+    Cache.LookaheadMemo.Emplace(LookaheadTime, Closest);
+    return Closest;
+}
+
+float UMCS_AttackChooser::GetHitLookaheadTime(const FMCS_AttackEntry& Entry) const
+{
+    if (Entry.HitLookaheadOverride >= 0.f)
+        return FMath::Min(Entry.HitLookaheadOverride, MaxPredictionTime);
+
+    const UAnimMontage* Montage = Entry.AttackMontage;
+    if (!Montage)
+        return 0.f;
+
+    const TPair<TObjectKey<UAnimMontage>, FName> Key(Montage, Entry.MontageSection);
+    if (const float* Cached = HitLookaheadCache.Find(Key))
+        return FMath::Min(*Cached, MaxPredictionTime);
+
+    // Playback starts at the chosen section (or the beginning)
+    float StartTime = 0.f;
+    const int32 SectionIndex = Entry.MontageSection.IsNone() ? INDEX_NONE : Montage->GetSectionIndex(Entry.MontageSection);
+    if (SectionIndex != INDEX_NONE)
+    {
+        StartTime = Montage->GetAnimCompositeSection(SectionIndex).GetTime();
+    }
+
+    // First hitbox window at or after the start
+    float FirstHitTime = TNumericLimits<float>::Max();
+    for (const FAnimNotifyEvent& Event : Montage->Notifies)
+    {
+        if (Cast<UAnimNotifyState_MCSHitboxWindow>(Event.NotifyStateClass) && Event.GetTriggerTime() >= StartTime)
+        {
+            FirstHitTime = FMath::Min(FirstHitTime, Event.GetTriggerTime());
+        }
+    }
+
+    const float RateScale = FMath::Max(Montage->RateScale, KINDA_SMALL_NUMBER);
+    const float Lookahead = FirstHitTime < TNumericLimits<float>::Max() ? (FirstHitTime - StartTime) / RateScale : 0.f;
+    HitLookaheadCache.Add(Key, Lookahead);
+    return FMath::Min(Lookahead, MaxPredictionTime);
+}
+
+void UMCS_AttackChooser::BuildTargetCache(const AActor* Instigator, const TArray<AActor*>& Targets, FMCS_ChooserTargetCache& OutCache) const
+{
+    OutCache.Reset();
+    OutCache.ClosestDistSq = TNumericLimits<float>::Max();
+    OutCache.bPassesBasicFilters = true;
+
+    if (!Instigator)
+        return;
+
+    OutCache.Instigator = Instigator;
+    OutCache.Targets = &Targets;
+
+    // Queriers are already in the snapshot; anyone else reads their transform directly
+    const int32 QuerierIndex = TargetSnapshot ? TargetSnapshot->FindQuerierIndex(Instigator) : INDEX_NONE;
+    if (QuerierIndex != INDEX_NONE)
+    {
+        OutCache.InstigatorLocation = TargetSnapshot->QuerierLocations[QuerierIndex];
+        OutCache.InstigatorForward = TargetSnapshot->QuerierForwards[QuerierIndex];
+    }
+    else
+    {
+        OutCache.InstigatorLocation = Instigator->GetActorLocation();
+        OutCache.InstigatorForward = Instigator->GetActorForwardVector();
+    }
+
+    OutCache.TargetLocations.Reserve(Targets.Num());
+    for (const AActor* Target : Targets)
     {
         if (!IsValid(Target))
             continue;
 
-        const FVector TargetLoc = Target->GetActorLocation();
-        const float DistSq = FVector::DistSquared(InstigatorLoc, TargetLoc);
-        if (MaxTargetDistance > 0.f && DistSq > FMath::Square(MaxTargetDistance))
+        const FVector TargetLoc = ResolveTargetLocation(Target);
+        OutCache.TargetLocations.Add(TargetLoc);
+
+        const FVector Relative = TargetLoc - OutCache.InstigatorLocation;
+        const FVector Velocity = ResolveTargetVelocity(Target);
+        OutCache.RelativeX.Add(Relative.X);
+        OutCache.RelativeY.Add(Relative.Y);
+        OutCache.RelativeZ.Add(Relative.Z);
+        OutCache.VelocityX.Add(Velocity.X);
+        OutCache.VelocityY.Add(Velocity.Y);
+        OutCache.VelocityZ.Add(Velocity.Z);
+
+        OutCache.ClosestDistSq = FMath::Min(OutCache.ClosestDistSq, static_cast<float>(FVector::DistSquared(OutCache.InstigatorLocation, TargetLoc)));
+    }
+
+    if (Targets.IsEmpty())
+        return;
+
+    // Basic filters: at least one target inside MaxTargetDistance and MaxTargetAngleDegrees
+    const bool bCheckDistance = MaxTargetDistance > 0.f;
+    const bool bCheckAngle = MaxTargetAngleDegrees > 0.f && MaxTargetAngleDegrees < 180.f;
+    const float MaxDistSq = FMath::Square(MaxTargetDistance);
+    const float MinCosAngle = FMath::Cos(FMath::DegreesToRadians(MaxTargetAngleDegrees));
+
+    OutCache.bPassesBasicFilters = false;
+    for (const FVector& TargetLoc : OutCache.TargetLocations)
+    {
+        const FVector ToTarget = TargetLoc - OutCache.InstigatorLocation;
+        if (bCheckDistance && ToTarget.SizeSquared() > MaxDistSq)
             continue;
 
-        if (MaxTargetAngleDegrees > 0.f && MaxTargetAngleDegrees < 180.f)
-        {
-            const FVector ToTarget = (TargetLoc - InstigatorLoc).GetSafeNormal();
-            const float CosAngle = FVector::DotProduct(InstigatorForward, ToTarget);
-            const float AngleDeg = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(CosAngle, -1.0f, 1.0f)));
-            if (AngleDeg > MaxTargetAngleDegrees)
-                continue;
-        }
+        if (bCheckAngle && FVector::DotProduct(OutCache.InstigatorForward, ToTarget.GetSafeNormal()) < MinCosAngle)
+            continue;
 
-        return true; // Passed
+        OutCache.bPassesBasicFilters = true; // Passed
+        break;
     }
+}
+
+const FMCS_ChooserTargetCache& UMCS_AttackChooser::GetTargetCache(const AActor* Instigator, const TArray<AActor*>& Targets, FMCS_ChooserTargetCache& Scratch) const
+{
+    if (TargetCache.IsBuiltFor(Instigator, Targets))
+        return TargetCache;
 
-    return false;
+    // Called outside ChooseAttack (e.g. from Blueprint)
+    BuildTargetCache(Instigator, Targets, Scratch);
+    return Scratch;
 }
 
 /**
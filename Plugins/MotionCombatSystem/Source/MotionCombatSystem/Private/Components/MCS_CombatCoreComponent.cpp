@@ -17,6 +17,7 @@
  */
 
 #include <Components/MCS_CombatCoreComponent.h>
+#include <SubSystems/MCS_CombatSignificanceSubsystem.h>
 #include "Kismet/GameplayStatics.h"
 #include "Animation/AnimInstance.h" 
 #include "GameFramework/Character.h"
@@ -65,12 +66,41 @@ void UMCS_CombatCoreComponent::BeginPlay()
         SetActiveAttackSet(FirstKey);
     }
 
-    // Bind to targeting updates
+    // Ask for our own target neighborhood (the subsystem calls HandleNeighborhoodChanged when it changes)
     if (TargetingSubsystem)
     {
-        TargetingSubsystem->OnTargetsUpdated.AddDynamic(this, &UMCS_CombatCoreComponent::HandleTargetsUpdated);
+        TargetingSubsystem->RegisterQuerier(GetOwnerActor(), TargetIncludeTeamMask, TargetExcludeTeamMask, bExcludeOwnTeam);
     }
 
+    // Let significance decide how much this combatant costs
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatSignificanceSubsystem* Significance = World->GetSubsystem<UMCS_CombatSignificanceSubsystem>())
+        {
+            Significance->RegisterCombatant(this);
+        }
+    }
+}
+
+// Called when the component is removed from play
+void UMCS_CombatCoreComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (TargetingSubsystem)
+    {
+        TargetingSubsystem->UnregisterQuerier(GetOwnerActor());
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        if (UMCS_CombatSignificanceSubsystem* Significance = World->GetSubsystem<UMCS_CombatSignificanceSubsystem>())
+        {
+            Significance->UnregisterCombatant(this);
+        }
+    }
+
+    UnbindAllNotifies();
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UMCS_CombatCoreComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -79,6 +109,38 @@ void UMCS_CombatCoreComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
     // UpdatePlayerSituation(DeltaTime); // Uncomment if you want to update PlayerSituation every frame in C++. Can be done in Blueprint instead.
 }
 
+/*
+ * Applies a combat LOD tier to this combatant and its hitbox
+ */
+void UMCS_CombatCoreComponent::ApplyCombatLOD(EMCS_CombatLOD NewLOD, const FMCS_CombatLODSettings& Settings)
+{
+    CombatLOD = NewLOD;
+    CombatLODSettings = Settings;
+
+    if (TargetingSubsystem)
+    {
+        TargetingSubsystem->SetQuerierRefreshInterval(GetOwnerActor(), Settings.TargetingRefreshInterval);
+    }
+
+    if (CachedHitboxComp)
+    {
+        CachedHitboxComp->ApplyCombatLOD(Settings);
+    }
+}
+
+/*
+ * Whether the current attack's montage is playing on the owner
+ */
+bool UMCS_CombatCoreComponent::IsAttacking() const
+{
+    const ACharacter* CharacterOwner = Cast<ACharacter>(GetOwner());
+    if (!CharacterOwner || !CurrentAttack.HasValidMontage() || !CharacterOwner->GetMesh())
+        return false;
+
+    const UAnimInstance* AnimInstance = CharacterOwner->GetMesh()->GetAnimInstance();
+    return AnimInstance && AnimInstance->Montage_IsPlaying(CurrentAttack.AttackMontage);
+}
+
 /*
  * Plays the selected attack's montage if valid
  * @param DesiredType - type of attack to perform
@@ -172,6 +234,15 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
     AActor* OwnerActor = GetOwnerActor();
     if (!OwnerActor) return false;
 
+    // Low combat LOD: reuse the last pick for the same request instead of scoring the set again
+    if (!CombatLODSettings.bFullChooserScoring && bHasCachedPick && CachedPickSetTag == ActiveAttackSetTag &&
+        CachedPickType == DesiredType && CachedPickDirection == DesiredDirection)
+    {
+        PlayerSituation = CurrentSituation;
+        CurrentAttack = CachedPick;
+        return true;
+    }
+
     // Filter by type
     TArray<FMCS_AttackEntry> FilteredEntries;
     for (const FMCS_AttackEntry& Entry : Chooser->AttackEntries)
@@ -187,12 +258,13 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
         return false;
     }
 
-    // Gather targets
+    // Gather targets around this combatant
     TArray<AActor*> Targets;
     if (TargetingSubsystem)
     {
-        for (const FMCS_TargetInfo& Info : TargetingSubsystem->GetAllTargets())
-            if (IsValid(Info.TargetActor))
+        // Visibility is cached by the subsystem, so this filter costs no traces
+        for (const FMCS_TargetInfo& Info : TargetingSubsystem->GetTargetsForInstigator(OwnerActor))
+            if (IsValid(Info.TargetActor) && (!Chooser->bRequireLineOfSight || Info.bHasLineOfSight))
                 Targets.Add(Info.TargetActor);
     }
 
@@ -203,13 +275,21 @@ bool UMCS_CombatCoreComponent::SelectAttack(EMCS_AttackType DesiredType, EMCS_At
     FMCS_AttackEntry ChosenAttack;
     const TArray<FMCS_AttackEntry> OriginalEntries = Chooser->AttackEntries;
     Chooser->AttackEntries = FilteredEntries;
+    Chooser->TargetSnapshot = TargetingSubsystem ? &TargetingSubsystem->GetTargetSnapshot() : nullptr;
 
     const bool bSuccess = Chooser->ChooseAttack(OwnerActor, Targets, DesiredDirection, CurrentSituation, ChosenAttack);
     Chooser->AttackEntries = OriginalEntries;
+    Chooser->TargetSnapshot = nullptr;
 
     if (bSuccess)
     {
         CurrentAttack = ChosenAttack;
+
+        CachedPick = ChosenAttack;
+        CachedPickSetTag = ActiveAttackSetTag;
+        CachedPickType = DesiredType;
+        CachedPickDirection = DesiredDirection;
+        bHasCachedPick = true;
     }
 
     return bSuccess;
@@ -296,12 +376,43 @@ AActor* UMCS_CombatCoreComponent::GetClosestTarget(float MaxRange) const
 
     if (AActor* OwnerActor = GetOwnerActor())
     {
-        return TargetingSubsystem->GetClosestTarget(OwnerActor->GetActorLocation(), MaxRange);
+        return TargetingSubsystem->GetClosestTargetForInstigator(OwnerActor, MaxRange);
     }
 
     return nullptr;
 }
 
+/*
+ * Updates the team filter and re-registers it with the targeting subsystem
+ */
+void UMCS_CombatCoreComponent::SetTargetTeamFilter(int32 IncludeTeamMask, int32 ExcludeTeamMask)
+{
+    TargetIncludeTeamMask = IncludeTeamMask;
+    TargetExcludeTeamMask = ExcludeTeamMask;
+
+    if (TargetingSubsystem)
+    {
+        TargetingSubsystem->SetQuerierTeamFilter(GetOwnerActor(), TargetIncludeTeamMask, TargetExcludeTeamMask, bExcludeOwnTeam);
+    }
+}
+
+/*
+ * Gets the highest-ranked target for this combatant
+ */
+AActor* UMCS_CombatCoreComponent::GetBestTarget() const
+{
+    return TargetingSubsystem ? TargetingSubsystem->GetBestTarget(GetOwnerActor()) : nullptr;
+}
+
+/*
+ * Switches the lock-on target to the left or right
+ * @param Direction - side to cycle towards
+ */
+AActor* UMCS_CombatCoreComponent::CycleLockOnTarget(EMCS_TargetCycleDirection Direction)
+{
+    return TargetingSubsystem ? TargetingSubsystem->CycleTarget(GetOwnerActor(), Direction) : nullptr;
+}
+
 /*
  * Utility to get the owning actor safely
  */
@@ -310,15 +421,14 @@ AActor* UMCS_CombatCoreComponent::GetOwnerActor() const
     return GetOwner();
 }
 
-// Handler for TargetingSubsystem target updates
-void UMCS_CombatCoreComponent::HandleTargetsUpdated(const TArray<FMCS_TargetInfo>& NewTargets, int32 NewTargetCount)
+// Handler for changes to this combatant's own target neighborhood
+void UMCS_CombatCoreComponent::HandleNeighborhoodChanged()
 {
-    // UE_LOG(LogTemp, Log, TEXT("[CombatCore] Target list changed: %d targets in range."), NewTargetCount);
-
-    // Fire the exposed Blueprint event
-    if (OnTargetingUpdated.IsBound())
+    // Fire the exposed Blueprint event with this combatant's own neighborhood
+    if (OnTargetingUpdated.IsBound() && TargetingSubsystem)
     {
-        OnTargetingUpdated.Broadcast(NewTargets, NewTargetCount);
+        const TArray<FMCS_TargetInfo>& LocalTargets = TargetingSubsystem->GetTargetsForInstigator(GetOwnerActor());
+        OnTargetingUpdated.Broadcast(LocalTargets, LocalTargets.Num());
     }
 }
 
@@ -479,10 +589,8 @@ void UMCS_CombatCoreComponent::HandleHitboxNotifyBegin(FMCS_AttackHitbox& Hitbox
     }
     if (!CachedHitboxComp) return;
 
-    // ✅ Automatically reset hit tracking whenever a new hitbox window begins
-    CachedHitboxComp->ResetAlreadyHit();
-
-    // Start hit detection for this hitbox
+    // Start hit detection for this hitbox (a new window starts with fresh hit tracking;
+    // overlapping windows on other sockets keep sweeping)
     CachedHitboxComp->StartHitDetection(CurrentAttack, Hitbox);
 
     // UE_LOG(LogTemp, Log, TEXT("[CombatCore] Hitbox BEGIN (Start:%s End:%s R:%.1f)"), *Hitbox.StartSocket.ToString(), *Hitbox.EndSocket.ToString(), Hitbox.Radius);
@@ -499,7 +607,7 @@ void UMCS_CombatCoreComponent::HandleHitboxNotifyEnd(FMCS_AttackHitbox& Hitbox)
 
     if (CachedHitboxComp)
     {
-        CachedHitboxComp->StopHitDetection();
+        CachedHitboxComp->StopHitboxWindow(Hitbox);
         // UE_LOG(LogTemp, Log, TEXT("[CombatCore] Hitbox END (Label:%s)"), *Hitbox.StartSocket.ToString());
     }
 }
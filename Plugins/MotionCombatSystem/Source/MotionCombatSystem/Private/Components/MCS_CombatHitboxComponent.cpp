@@ -16,18 +16,38 @@
 #include "Components/MCS_CombatHitboxComponent.h"
 #include "GameFramework/Actor.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/SkinnedAsset.h"
+#include "Animation/AnimInstance.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
+#include <SubSystems/MCS_TargetingSubsystem.h>
+#include <SubSystems/MCS_HitboxSweepSubsystem.h>
+#include <Debug/MCS_HitboxDebugBatch.h>
+
+static TAutoConsoleVariable<int32> CVarMCS_HitboxMaxSubsteps(
+    TEXT("mcs.Hitbox.MaxSubsteps"),
+    16,
+    TEXT("Global cap on hitbox sweep substeps per tick (applies to adaptive and fixed substeps)"),
+    ECVF_Default);
 
 UMCS_CombatHitboxComponent::UMCS_CombatHitboxComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.bStartWithTickEnabled = false; // tick only when detecting
+
+    PendingHitAttacks.SetNum(MaxActiveHitboxes);
+    DispatchingHitAttacks.SetNum(MaxActiveHitboxes);
 }
 
 void UMCS_CombatHitboxComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (UWorld* World = GetWorld())
+    {
+        TargetingSubsystem = World->GetSubsystem<UMCS_TargetingSubsystem>();
+        SweepSubsystem = World->GetSubsystem<UMCS_HitboxSweepSubsystem>();
+    }
 }
 
 void UMCS_CombatHitboxComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -38,105 +58,631 @@ void UMCS_CombatHitboxComponent::TickComponent(float DeltaTime, ELevelTick TickT
     {
         PerformSweep();
     }
+
+#if MCS_HITBOX_DEBUG_DRAW
+    DebugBatch.Flush(GetWorld());
+#endif
+
+    // Fixed-step windows finish draining inside PerformSweep
+    if (!bIsDetecting)
+    {
+        SetComponentTickEnabled(false);
+    }
 }
 
 void UMCS_CombatHitboxComponent::StartHitDetection(const FMCS_AttackEntry& Attack, const FMCS_AttackHitbox& Hitbox)
 {
-    // ActiveHitbox = Attack.Hitbox; // cache hitbox from AttackType
-    ActiveAttack = Attack;          // cache full attack type
-    ActiveHitbox = Hitbox;          // cache hitbox
+    const int32 WindowIndex = FindWindowSlot(Hitbox);
+    FMCS_ActiveHitboxWindow& Window = Windows[WindowIndex];
+    if (Window.bActive && !Window.UsesSockets(Hitbox))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_CombatHitboxComponent] %d hitbox windows already active on %s; replacing the oldest (%s → %s)."),
+            MaxActiveHitboxes, *GetNameSafe(GetOwner()), *Window.Hitbox.StartSocket.ToString(), *Window.Hitbox.EndSocket.ToString());
+    }
+
+    Window.Attack = Attack;         // cache full attack type
+    Window.Hitbox = Hitbox;         // cache hitbox
+    Window.Serial = ++WindowSerial;
+    Window.bActive = true;
+    Window.bDrainFixedSteps = false;
+    Window.LastFixedStep = INDEX_NONE;
     bIsDetecting = true;
 
-    AlreadyHitActors.Reset(); // clear at start of swing
+    Window.ResetHits(); // clear at start of swing
 
-    // Cache initial socket positions
+    // Cache initial socket positions (from the baked curve when there is one)
     if (USkeletalMeshComponent* Mesh = ResolveMesh())
     {
-        PrevStartLoc = Mesh->GetSocketLocation(ActiveHitbox.StartSocket);
-        PrevEndLoc = Mesh->GetSocketLocation(ActiveHitbox.EndSocket);
+        ResolveWindowSockets(Mesh, Window);
+        Window.PrevMeshTransform = Mesh->GetComponentTransform();
+        if (Window.Hitbox.HasBakedTrajectory() && GetBakedWindowTime(Mesh, Window, Window.PrevWindowTime))
+        {
+            FVector LocalStart, LocalEnd;
+            Window.Hitbox.EvaluateBakedTrajectory(Window.PrevWindowTime, LocalStart, LocalEnd);
+            Window.PrevStartLoc = Window.PrevMeshTransform.TransformPosition(LocalStart);
+            Window.PrevEndLoc = Window.PrevMeshTransform.TransformPosition(LocalEnd);
+        }
+        else
+        {
+            Window.PrevStartLoc = GetSocketWorldLocation(Mesh, Window.PrevMeshTransform, Window.StartBone, Window.Hitbox.StartSocket);
+            Window.PrevEndLoc = GetSocketWorldLocation(Mesh, Window.PrevMeshTransform, Window.EndBone, Window.Hitbox.EndSocket);
+        }
+    }
+
+    // Join the world's sweep batch; tick on our own only when there is none
+    if (UMCS_HitboxSweepSubsystem* Batch = SweepSubsystem.Get())
+    {
+        Batch->RegisterHitbox(this);
+    }
+    else
+    {
+        SetComponentTickEnabled(true); // enable ticking
+    }
+}
+
+int32 UMCS_CombatHitboxComponent::FindWindowSlot(const FMCS_AttackHitbox& Hitbox) const
+{
+    int32 FreeSlot = INDEX_NONE;
+    int32 OldestSlot = 0;
+    for (int32 Index = 0; Index < MaxActiveHitboxes; ++Index)
+    {
+        const FMCS_ActiveHitboxWindow& Window = Windows[Index];
+        if (Window.Serial != 0 && Window.UsesSockets(Hitbox))
+            return Index; // same socket pair restarts
+
+        if (!Window.bActive && (FreeSlot == INDEX_NONE || Window.Serial < Windows[FreeSlot].Serial))
+        {
+            FreeSlot = Index; // least recently used free slot, so stopped windows keep their hit sets longest
+        }
+
+        if (Window.Serial < Windows[OldestSlot].Serial)
+        {
+            OldestSlot = Index;
+        }
     }
 
-    SetComponentTickEnabled(true); // enable ticking
+    return FreeSlot != INDEX_NONE ? FreeSlot : OldestSlot;
+}
+
+void UMCS_CombatHitboxComponent::ApplyCombatLOD(const FMCS_CombatLODSettings& Settings)
+{
+    LODSubstepCount = Settings.SubstepCount;
+    bLODAllowDebugDraw = Settings.bAllowDebugDraw;
+
+    // Sweeps interpolate from the previous sweep's sockets, so a longer interval still covers the whole swing
+    LODTickInterval = Settings.TickInterval;
+    SetComponentTickInterval(Settings.TickInterval);
 }
 
 void UMCS_CombatHitboxComponent::StopHitDetection()
 {
-    bIsDetecting = false;
-    AlreadyHitActors.Reset(); // clear at end of swing
+    // Hit sets are cleared when a slot's next window starts, so late async results of this swing still dedupe
+    for (FMCS_ActiveHitboxWindow& Window : Windows)
+    {
+        StopWindow(Window);
+    }
+
+    UpdateDetecting();
+}
+
+void UMCS_CombatHitboxComponent::StopHitboxWindow(const FMCS_AttackHitbox& Hitbox)
+{
+    for (FMCS_ActiveHitboxWindow& Window : Windows)
+    {
+        if (Window.bActive && Window.UsesSockets(Hitbox))
+        {
+            StopWindow(Window);
+        }
+    }
+
+    UpdateDetecting();
+}
+
+void UMCS_CombatHitboxComponent::StopWindow(FMCS_ActiveHitboxWindow& Window) const
+{
+    // Fixed-step windows keep sweeping up to their last step, so the result does not depend on the frame the notify ended on
+    if (Window.bActive && UsesFixedTimestep(Window))
+    {
+        Window.bDrainFixedSteps = true;
+        return;
+    }
+
+    Window.bActive = false;
+}
+
+void UMCS_CombatHitboxComponent::UpdateDetecting()
+{
+    bIsDetecting = GetNumActiveHitboxes() > 0;
+    if (bIsDetecting)
+        return;
+
+    if (UMCS_HitboxSweepSubsystem* Batch = SweepSubsystem.Get())
+    {
+        Batch->UnregisterHitbox(this);
+    }
     SetComponentTickEnabled(false); // disable ticking
 }
 
+int32 UMCS_CombatHitboxComponent::GetNumActiveHitboxes() const
+{
+    int32 NumActive = 0;
+    for (const FMCS_ActiveHitboxWindow& Window : Windows)
+    {
+        NumActive += Window.bActive ? 1 : 0;
+    }
+    return NumActive;
+}
+
+void UMCS_CombatHitboxComponent::ResetAlreadyHit()
+{
+    for (FMCS_ActiveHitboxWindow& Window : Windows)
+    {
+        if (Window.bActive)
+        {
+            Window.ResetHits();
+        }
+    }
+}
+
+bool UMCS_CombatHitboxComponent::IsAsyncSweep() const
+{
+    // Mixed windows resolve synchronously together; analytic windows never go async
+    bool bAnyActive = false;
+    for (const FMCS_ActiveHitboxWindow& Window : Windows)
+    {
+        if (!Window.bActive)
+            continue;
+
+        if (!Window.Hitbox.bAsyncSweep || Window.Hitbox.bAnalyticTargetHits)
+            return false;
+
+        bAnyActive = true;
+    }
+    return bAnyActive;
+}
+
 void UMCS_CombatHitboxComponent::PerformSweep()
 {
-    // Get mesh component
+    ScratchRequests.Reset();
+    ScratchHits.Reset();
+    BuildSweepRequests(ScratchRequests);
+
+    UMCS_HitboxSweepSubsystem::RunSweeps(GetWorld(), ScratchRequests, ScratchHits, SweepScratch);
+    ProcessSweepHits(ScratchRequests, ScratchHits);
+    FlushHitEvents();
+}
+
+void UMCS_CombatHitboxComponent::BuildSweepRequests(TArray<FMCS_HitboxSweepRequest>& OutRequests)
+{
+    // Get mesh component (once for every window)
     USkeletalMeshComponent* Mesh = ResolveMesh();
+    if (!Mesh)
+        return;
+
+    for (int32 WindowIndex = 0; WindowIndex < MaxActiveHitboxes; ++WindowIndex)
+    {
+        if (Windows[WindowIndex].bActive)
+        {
+            BuildWindowSweepRequests(Mesh, WindowIndex, OutRequests);
+        }
+    }
+}
+
+void UMCS_CombatHitboxComponent::BuildWindowSweepRequests(USkeletalMeshComponent* Mesh, int32 WindowIndex, TArray<FMCS_HitboxSweepRequest>& OutRequests)
+{
+    FMCS_ActiveHitboxWindow& Window = Windows[WindowIndex];
+    const FMCS_AttackHitbox& Hitbox = Window.Hitbox;
 
-    // Validate mesh and sockets
-    if (!Mesh || ActiveHitbox.StartSocket == NAME_None || ActiveHitbox.EndSocket == NAME_None)
+    // Validate sockets
+    if (Hitbox.StartSocket == NAME_None || Hitbox.EndSocket == NAME_None)
         return;
 
-    // Get current socket locations
-    const FVector CurrStart = Mesh->GetSocketLocation(ActiveHitbox.StartSocket);
-    const FVector CurrEnd = Mesh->GetSocketLocation(ActiveHitbox.EndSocket);
+    // Deterministic mode: fixed montage-time steps instead of per-frame substeps
+    if (UsesFixedTimestep(Window))
+    {
+        BuildFixedStepRequests(Mesh, WindowIndex, OutRequests);
+        return;
+    }
+
+    // Baked trajectory: evaluate the curve at each substep's montage time instead of reading the pose
+    float CurrWindowTime = 0.0f;
+    const bool bUseBaked = Hitbox.HasBakedTrajectory() && GetBakedWindowTime(Mesh, Window, CurrWindowTime);
+    const FTransform CurrMeshTransform = Mesh->GetComponentTransform();
+    if (bUseBaked && CurrWindowTime < Window.PrevWindowTime)
+    {
+        Window.PrevWindowTime = CurrWindowTime; // section jump or restart
+    }
+
+    FVector CurrStart, CurrEnd;
+    if (bUseBaked)
+    {
+        FVector LocalStart, LocalEnd;
+        Hitbox.EvaluateBakedTrajectory(CurrWindowTime, LocalStart, LocalEnd);
+        CurrStart = CurrMeshTransform.TransformPosition(LocalStart);
+        CurrEnd = CurrMeshTransform.TransformPosition(LocalEnd);
+    }
+    else
+    {
+        // Get current socket locations (resolved bones, no name lookups)
+        CurrStart = GetSocketWorldLocation(Mesh, CurrMeshTransform, Window.StartBone, Hitbox.StartSocket);
+        CurrEnd = GetSocketWorldLocation(Mesh, CurrMeshTransform, Window.EndBone, Hitbox.EndSocket);
+    }
 
     // Sweep multiple times between previous and current positions (substepping)
-    for (int32 i = 0; i < SubstepCount; i++)
+    const int32 NumSubsteps = ComputeSubstepCount(Window, CurrStart, CurrEnd);
+    FVector StepStart = Window.PrevStartLoc;
+    FVector StepEnd = Window.PrevEndLoc;
+    for (int32 i = 0; i < NumSubsteps; i++)
+    {
+        const float Alpha = (i + 1) / static_cast<float>(NumSubsteps);
+        const FVector LastStepStart = StepStart;
+        const FVector LastStepEnd = StepEnd;
+
+        if (bUseBaked)
+        {
+            // Exact arc at the sub-frame time; only the mesh transform is interpolated
+            FTransform StepTransform;
+            StepTransform.Blend(Window.PrevMeshTransform, CurrMeshTransform, Alpha);
+
+            FVector LocalStart, LocalEnd;
+            Hitbox.EvaluateBakedTrajectory(FMath::Lerp(Window.PrevWindowTime, CurrWindowTime, Alpha), LocalStart, LocalEnd);
+            StepStart = StepTransform.TransformPosition(LocalStart);
+            StepEnd = StepTransform.TransformPosition(LocalEnd);
+        }
+        else
+        {
+            StepStart = FMath::Lerp(Window.PrevStartLoc, CurrStart, Alpha);
+            StepEnd = FMath::Lerp(Window.PrevEndLoc, CurrEnd, Alpha);
+        }
+
+        AddBladeRequest(WindowIndex, LastStepStart, LastStepEnd, StepStart, StepEnd, OutRequests);
+    }
+
+    // Update previous socket locations for next frame
+    Window.PrevStartLoc = CurrStart;
+    Window.PrevEndLoc = CurrEnd;
+    Window.PrevWindowTime = CurrWindowTime;
+    Window.PrevMeshTransform = CurrMeshTransform;
+
+#if MCS_HITBOX_DEBUG_DRAW
+    // Draw socket spheres
+    if (FMCS_HitboxDebugBatch* DebugLines = GetDebugBatch(Hitbox))
+    {
+        DebugLines->AddSphere(CurrStart, Hitbox.Radius, FColor::Blue, 8);
+        DebugLines->AddSphere(CurrEnd, Hitbox.Radius, FColor::Blue, 8);
+    }
+#endif
+}
+
+USkeletalMeshComponent* UMCS_CombatHitboxComponent::ResolveMesh()
+{
+    USkeletalMeshComponent* Mesh = CachedMesh.Get();
+    if (!Mesh || Mesh->GetOwner() != GetOwner())
+    {
+        const AActor* Owner = GetOwner();
+        Mesh = Owner ? Owner->FindComponentByClass<USkeletalMeshComponent>() : nullptr;
+        CachedMesh = Mesh;
+    }
+
+    // New component or new mesh asset: bone indices are stale
+    const USkinnedAsset* MeshAsset = Mesh ? Mesh->GetSkinnedAsset() : nullptr;
+    if (Mesh && MeshAsset != ResolvedMeshAsset.Get())
+    {
+        ResolvedMeshAsset = MeshAsset;
+        for (FMCS_ActiveHitboxWindow& Window : Windows)
+        {
+            if (Window.bActive)
+            {
+                ResolveWindowSockets(Mesh, Window);
+            }
+        }
+    }
+
+    return Mesh;
+}
+
+void UMCS_CombatHitboxComponent::ResolveWindowSockets(const USkeletalMeshComponent* Mesh, FMCS_ActiveHitboxWindow& Window)
+{
+    auto Resolve = [ Mesh ] (FName SocketName, FMCS_ResolvedSocket& OutSocket)
+        {
+            OutSocket = FMCS_ResolvedSocket();
+            if (SocketName == NAME_None)
+                return;
+
+            // Sockets first, then plain bone names (same order GetSocketLocation uses)
+            if (const USkeletalMeshSocket* Socket = Mesh->GetSocketByName(SocketName))
+            {
+                OutSocket.BoneIndex = Mesh->GetBoneIndex(Socket->BoneName);
+                OutSocket.BoneOffset = Socket->RelativeLocation;
+            }
+            else
+            {
+                OutSocket.BoneIndex = Mesh->GetBoneIndex(SocketName);
+            }
+        };
+
+    Resolve(Window.Hitbox.StartSocket, Window.StartBone);
+    Resolve(Window.Hitbox.EndSocket, Window.EndBone);
+}
+
+FVector UMCS_CombatHitboxComponent::GetSocketWorldLocation(const USkeletalMeshComponent* Mesh, const FTransform& ComponentTransform, const FMCS_ResolvedSocket& Socket, FName SocketName)
+{
+    // Meshes following a leader pose have no transforms of their own; let the engine map the bone
+    const TArray<FTransform>& BoneTransforms = Mesh->GetComponentSpaceTransforms();
+    if (Mesh->LeaderPoseComponent.IsValid() || !BoneTransforms.IsValidIndex(Socket.BoneIndex))
+        return Mesh->GetSocketLocation(SocketName);
+
+    return ComponentTransform.TransformPosition(BoneTransforms[Socket.BoneIndex].TransformPosition(Socket.BoneOffset));
+}
+
+void UMCS_CombatHitboxComponent::AddBladeRequest(int32 WindowIndex, const FVector& LastStart, const FVector& LastEnd, const FVector& Start, const FVector& End, TArray<FMCS_HitboxSweepRequest>& OutRequests) const
+{
+    const FMCS_ActiveHitboxWindow& Window = Windows[WindowIndex];
+    const FMCS_AttackHitbox& Hitbox = Window.Hitbox;
+
+    FMCS_HitboxSweepRequest& Request = OutRequests.AddDefaulted_GetRef();
+    Request.WindowIndex = WindowIndex;
+    Request.WindowSerial = Window.Serial;
+    Request.FrameNumber = GFrameCounter;
+    Request.Radius = Hitbox.Radius;
+    Request.Start = Start;
+    Request.End = End;
+    Request.BladeStart = Start;
+    Request.BladeEnd = End;
+    Request.PrevBladeStart = LastStart;
+    Request.PrevBladeEnd = LastEnd;
+    Request.bAnalyticTargets = Hitbox.bAnalyticTargetHits;
+    Request.bSweepWorldGeometry = Hitbox.bSweepWorldGeometry;
+
+#if MCS_HITBOX_DEBUG_DRAW
+    FMCS_HitboxDebugBatch* DebugLines = GetDebugBatch(Hitbox);
+#endif
+
+    // Swept capsule: a blade-aligned capsule moved from the last substep's blade midpoint to this one's
+    const FVector BladeAxis = (LastEnd - LastStart) + (End - Start);
+    if (Hitbox.SweepShape == EMCS_HitboxSweepShape::SweptCapsule && !BladeAxis.IsNearlyZero())
+    {
+        const float HalfBladeLength = 0.5f * FMath::Sqrt(FMath::Max(FVector::DistSquared(LastStart, LastEnd), FVector::DistSquared(Start, End)));
+        Request.Start = 0.5f * (LastStart + LastEnd);
+        Request.End = 0.5f * (Start + End);
+        Request.Rotation = FRotationMatrix::MakeFromZ(BladeAxis).ToQuat();
+        Request.HalfHeight = HalfBladeLength + Hitbox.Radius;
+
+#if MCS_HITBOX_DEBUG_DRAW
+        if (DebugLines)
+        {
+            DebugLines->AddCapsule(Request.End, Request.HalfHeight, Request.Radius, Request.Rotation, FColor::Green);
+        }
+#endif
+        return;
+    }
+
+#if MCS_HITBOX_DEBUG_DRAW
+    // Draw sweep line
+    if (DebugLines)
+    {
+        DebugLines->AddLine(Request.Start, Request.End, FColor::Green, 1.5f);
+    }
+#endif
+}
+
+#if MCS_HITBOX_DEBUG_DRAW
+FMCS_HitboxDebugBatch* UMCS_CombatHitboxComponent::GetDebugBatch(const FMCS_AttackHitbox& Hitbox) const
+{
+    if (!bLODAllowDebugDraw || !FMCS_HitboxDebugBatch::ShouldDraw(GetOwner(), Hitbox.bDebugDraw))
+        return nullptr;
+
+    // Every batched hitbox shares the subsystem's buffer; the fallback path flushes its own each tick
+    if (UMCS_HitboxSweepSubsystem* Batch = SweepSubsystem.Get())
+        return &Batch->GetDebugBatch();
+
+    return &DebugBatch;
+}
+#endif
+
+void UMCS_CombatHitboxComponent::BuildFixedStepRequests(USkeletalMeshComponent* Mesh, int32 WindowIndex, TArray<FMCS_HitboxSweepRequest>& OutRequests)
+{
+    FMCS_ActiveHitboxWindow& Window = Windows[WindowIndex];
+    const FMCS_AttackHitbox& Hitbox = Window.Hitbox;
+
+    // Step k sits at window time k / FixedStepRate: an integer step index, so every machine evaluates the same times
+    const float StepRate = FMath::Max(FixedStepRate, 1.0f);
+    const float WindowDuration = Hitbox.BakedSampleInterval * (Hitbox.BakedStartPositions.Num() - 1);
+    const int32 LastWindowStep = FMath::FloorToInt(WindowDuration * StepRate);
+
+    // A draining window's montage may have moved on or stopped; its remaining steps run up to the window's end
+    float CurrWindowTime = 0.0f;
+    const bool bHasWindowTime = GetBakedWindowTime(Mesh, Window, CurrWindowTime);
+    int32 TargetStep = LastWindowStep;
+    if (Window.bDrainFixedSteps)
+    {
+        CurrWindowTime = FMath::Max(bHasWindowTime ? CurrWindowTime : 0.0f, WindowDuration);
+    }
+    else
+    {
+        if (!bHasWindowTime)
+            return;
+        TargetStep = FMath::Min(FMath::FloorToInt(CurrWindowTime * StepRate), LastWindowStep);
+    }
+
+    // Several steps per frame at low frame rates; a backlog beyond the cap carries over to the next frame
+    TargetStep = FMath::Min(TargetStep, Window.LastFixedStep + FMath::Max(MaxFixedStepsPerFrame, 1));
+
+    // The mesh transform is placed at each step's own montage time, interpolated from the last step (or the window
+    // start) to this frame, as the per-frame substeps do. A frame boundary then only changes where the attacker's
+    // movement is sampled, not which transform a step uses.
+    const float BaseTime = Window.PrevWindowTime;
+    const FTransform BaseTransform = Window.PrevMeshTransform;
+    const FTransform CurrMeshTransform = Mesh->GetComponentTransform();
+    const float TimeSpan = CurrWindowTime - BaseTime;
+
+    for (int32 Step = Window.LastFixedStep + 1; Step <= TargetStep; ++Step)
+    {
+        const float StepTime = static_cast<float>(Step) / StepRate;
+        const float Alpha = TimeSpan > UE_SMALL_NUMBER ? FMath::Clamp((StepTime - BaseTime) / TimeSpan, 0.0f, 1.0f) : 1.0f;
+
+        FTransform StepTransform;
+        StepTransform.Blend(BaseTransform, CurrMeshTransform, Alpha);
+
+        FVector LocalStart, LocalEnd;
+        Hitbox.EvaluateBakedTrajectory(StepTime, LocalStart, LocalEnd);
+        const FVector Start = StepTransform.TransformPosition(LocalStart);
+        const FVector End = StepTransform.TransformPosition(LocalEnd);
+
+        // Each step sweeps from the previous step's blade (step 0 has none and only tests its own position)
+        const bool bFirstStep = Window.LastFixedStep == INDEX_NONE;
+        AddBladeRequest(WindowIndex, bFirstStep ? Start : Window.PrevStartLoc, bFirstStep ? End : Window.PrevEndLoc, Start, End, OutRequests);
+
+        Window.LastFixedStep = Step;
+        Window.PrevStartLoc = Start;
+        Window.PrevEndLoc = End;
+        Window.PrevWindowTime = StepTime;
+        Window.PrevMeshTransform = StepTransform;
+    }
+
+    // An ended window finishes once its last step has run, no matter which frame the notify ended on
+    if (Window.bDrainFixedSteps && Window.LastFixedStep >= LastWindowStep)
+    {
+        Window.bActive = false;
+        Window.bDrainFixedSteps = false;
+        bIsDetecting = GetNumActiveHitboxes() > 0; // the sweep batch drops us on its next tick
+    }
+}
+
+int32 UMCS_CombatHitboxComponent::ComputeSubstepCount(const FMCS_ActiveHitboxWindow& Window, const FVector& CurrStart, const FVector& CurrEnd) const
+{
+    const FMCS_AttackHitbox& Hitbox = Window.Hitbox;
+    int32 NumSubsteps = SubstepCount;
+
+    // Enough substeps that neither socket moves more than SubstepSpacing radii between consecutive sweeps
+    if (Hitbox.bAdaptiveSubsteps)
     {
-        const float Alpha = (i + 1) / static_cast<float>(SubstepCount);
+        const float Travel = FMath::Sqrt(FMath::Max(FVector::DistSquared(Window.PrevStartLoc, CurrStart), FVector::DistSquared(Window.PrevEndLoc, CurrEnd)));
+        const float MaxStep = FMath::Max(Hitbox.Radius * Hitbox.SubstepSpacing, 1.0f);
+        const int32 MinSteps = FMath::Max(Hitbox.MinSubsteps, 1);
+        NumSubsteps = FMath::Clamp(FMath::CeilToInt(Travel / MaxStep), MinSteps, FMath::Max(Hitbox.MaxSubsteps, MinSteps));
+    }
+
+    // Combat LOD may force fewer substeps for distant combatants
+    if (LODSubstepCount > 0)
+    {
+        NumSubsteps = FMath::Min(NumSubsteps, LODSubstepCount);
+    }
 
-        const FVector StepStart = FMath::Lerp(PrevStartLoc, CurrStart, Alpha);
-        const FVector StepEnd = FMath::Lerp(PrevEndLoc, CurrEnd, Alpha);
+    return FMath::Clamp(NumSubsteps, 1, FMath::Max(CVarMCS_HitboxMaxSubsteps.GetValueOnGameThread(), 1));
+}
+
+bool UMCS_CombatHitboxComponent::GetBakedWindowTime(const USkeletalMeshComponent* Mesh, const FMCS_ActiveHitboxWindow& Window, float& OutWindowTime)
+{
+    const UAnimMontage* Montage = Window.Attack.AttackMontage;
+    const UAnimInstance* AnimInstance = Mesh ? Mesh->GetAnimInstance() : nullptr;
+    if (!AnimInstance || !Montage || !AnimInstance->Montage_IsPlaying(Montage))
+        return false;
 
-        FCollisionQueryParams Params(SCENE_QUERY_STAT(PGAS_Hitbox), false, GetOwner()); // Setup collision parameters
-        TArray<FHitResult> Hits; // Array to store hit results
+    OutWindowTime = AnimInstance->Montage_GetPosition(Montage) - Window.Hitbox.BakedWindowStart;
+    return true;
+}
 
-        // Perform the sweep
-        GetWorld()->SweepMultiByObjectType(
-            Hits,
-            StepStart,
-            StepEnd,
-            FQuat::Identity,
-            FCollisionObjectQueryParams(ECC_Pawn),
-            FCollisionShape::MakeSphere(ActiveHitbox.Radius),
-            Params
-        );
+void UMCS_CombatHitboxComponent::ProcessSweepHits(TArrayView<const FMCS_HitboxSweepRequest> SweepRequests, const TArray<FHitResult>& Hits)
+{
+    const bool bHadPendingEvents = !PendingHitEvents.IsEmpty();
+
+    for (const FMCS_HitboxSweepRequest& Request : SweepRequests)
+    {
+        if (Request.WindowIndex < 0 || Request.WindowIndex >= MaxActiveHitboxes)
+            continue;
 
         // Process hit results
-        for (const FHitResult& Hit : Hits)
+        FMCS_ActiveHitboxWindow& Window = Windows[Request.WindowIndex];
+        for (int32 HitIndex = Request.FirstHit; HitIndex < Request.FirstHit + Request.NumHits; ++HitIndex)
         {
+            // The slot was given to a newer window since the request was built; these hits belong to the old one.
+            // A window that merely ended keeps its serial, so its final sweeps are still delivered.
+            if (Window.Serial != Request.WindowSerial)
+                break;
+
+            const FHitResult& Hit = Hits[HitIndex];
             if (AActor* HitActor = Hit.GetActor())
             {
                 if (HitActor == GetOwner()) // skip self
                     continue;
 
-                if (AlreadyHitActors.Contains(HitActor)) // skip duplicate hits in same swing
+                // skip duplicate hits in same swing (slot lookup is a map find, no allocation)
+                const int32 TargetSlot = TargetingSubsystem.IsValid() ? TargetingSubsystem->FindTargetSlot(HitActor) : INDEX_NONE;
+                const uint32 SlotGeneration = TargetSlot != INDEX_NONE ? TargetingSubsystem->GetTargetSnapshot().SlotGenerations[TargetSlot] : 0;
+                if (Window.WasHit(HitActor, TargetSlot, SlotGeneration))
+                    continue;
+
+                // skip allies (same team filter the owner targets with)
+                if (TargetingSubsystem.IsValid() && !TargetingSubsystem->IsTeamAllowedForInstigator(GetOwner(), HitActor))
                     continue;
 
-                AlreadyHitActors.Add(HitActor); // mark as hit
-                OnHitboxHit.Broadcast(HitActor, Hit, ActiveAttack); // Broadcast hit event
+                Window.MarkHit(HitActor, TargetSlot, SlotGeneration); // mark as hit
+
+                // Listeners may replace the window before the batch reaches everyone; hand out a copy of its attack
+                const uint32 SlotBit = 1u << Request.WindowIndex;
+                if ((PendingHitAttackMask & SlotBit) == 0)
+                {
+                    PendingHitAttacks[Request.WindowIndex] = Window.Attack;
+                    PendingHitAttackMask |= SlotBit;
+                }
+
+                // Queue the hit; listeners get the whole frame's hits in one batch
+                FMCS_HitEvent& Event = PendingHitEvents.AddDefaulted_GetRef();
+                Event.HitActor = HitActor;
+                Event.Hitbox = this;
+                Event.Attack = &PendingHitAttacks[Request.WindowIndex];
+                Event.Hit = Hit;
+                Event.TargetSlot = TargetSlot;
+                Event.WindowIndex = Request.WindowIndex;
+                Event.WindowSerial = Request.WindowSerial;
+                Event.FrameNumber = Request.FrameNumber;
+                Event.bWorldGeometry = HitIndex >= Request.FirstHit + Request.NumHits - Request.NumWorldHits;
 
-                if (ActiveHitbox.bDebugDraw)
+#if MCS_HITBOX_DEBUG_DRAW
+                if (FMCS_HitboxDebugBatch* DebugLines = GetDebugBatch(Window.Hitbox))
                 {
-                    DrawDebugSphere(GetWorld(), Hit.ImpactPoint, ActiveHitbox.Radius, 12, FColor::Red, false, 0.05f);
+                    DebugLines->AddSphere(Hit.ImpactPoint, Window.Hitbox.Radius, FColor::Red);
                 }
+#endif
             }
         }
+    }
 
-        // Draw sweep line
-        if (ActiveHitbox.bDebugDraw)
+    // First hits this frame: ask the batch to flush us after every sweep has run
+    if (!bHadPendingEvents && !PendingHitEvents.IsEmpty())
+    {
+        if (UMCS_HitboxSweepSubsystem* Batch = SweepSubsystem.Get())
         {
-            DrawDebugLine(GetWorld(), StepStart, StepEnd, FColor::Green, false, 0.05f, 0, 1.5f);
+            Batch->QueueHitEventFlush(this);
         }
     }
+}
 
-    // Update previous socket locations for next frame
-    PrevStartLoc = CurrStart;
-    PrevEndLoc = CurrEnd;
+void UMCS_CombatHitboxComponent::FlushHitEvents()
+{
+    if (PendingHitEvents.IsEmpty())
+        return;
 
-    // Draw socket spheres
-    if (ActiveHitbox.bDebugDraw)
+    // Listeners may start or stop windows (which can queue new hits); broadcast from a swapped buffer.
+    // Swapping the attack arrays exchanges their allocations, so the events still point at their copies.
+    Swap(PendingHitEvents, DispatchingHitEvents);
+    Swap(PendingHitAttacks, DispatchingHitAttacks);
+    PendingHitAttackMask = 0;
+
+    OnHitEvents.Broadcast(DispatchingHitEvents);
+
+    // Blueprint adapters: one broadcast per hit, only paid for when bound
+    if (OnHitboxHit.IsBound() || OnHitboxWorldHit.IsBound())
     {
-        DrawDebugSphere(GetWorld(), CurrStart, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
-        DrawDebugSphere(GetWorld(), CurrEnd, ActiveHitbox.Radius, 8, FColor::Blue, false, 0.05f);
+        for (const FMCS_HitEvent& Event : DispatchingHitEvents)
+        {
+            if (IsValid(Event.HitActor) && Event.Attack)
+            {
+                (Event.bWorldGeometry ? OnHitboxWorldHit : OnHitboxHit).Broadcast(Event.HitActor, Event.Hit, *Event.Attack);
+            }
+        }
     }
+
+    DispatchingHitEvents.Reset();
 }
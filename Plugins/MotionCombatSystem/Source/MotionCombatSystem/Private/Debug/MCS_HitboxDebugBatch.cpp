@@ -0,0 +1,118 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxDebugBatch.cpp
+ * Implementation of the batched hitbox debug lines.
+ */
+
+#include <Debug/MCS_HitboxDebugBatch.h>
+
+#if MCS_HITBOX_DEBUG_DRAW
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+static TAutoConsoleVariable<int32> CVarMCS_HitboxDebug(
+    TEXT("mcs.Hitbox.Debug"),
+    0,
+    TEXT("Hitbox debug drawing: 0 = off, 1 = hitboxes flagged bDebugDraw, 2 = every hitbox"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarMCS_HitboxDebugFilter(
+    TEXT("mcs.Hitbox.DebugFilter"),
+    TEXT(""),
+    TEXT("Only draw hitboxes of actors whose name contains this text (empty = all actors)"),
+    ECVF_Default);
+
+namespace MCS_HitboxDebug
+{
+    // Matches the old per-call DrawDebug lifetime, so a frame's lines last until the next frame replaces them
+    constexpr float LineLifeTime = 0.05f;
+}
+
+bool FMCS_HitboxDebugBatch::ShouldDraw(const AActor* Owner, bool bHitboxDebugDraw)
+{
+    const int32 Mode = CVarMCS_HitboxDebug.GetValueOnGameThread();
+    if (Mode <= 0 || (Mode == 1 && !bHitboxDebugDraw))
+        return false;
+
+    const FString Filter = CVarMCS_HitboxDebugFilter.GetValueOnGameThread();
+    return Filter.IsEmpty() || (Owner && Owner->GetName().Contains(Filter));
+}
+
+void FMCS_HitboxDebugBatch::AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness)
+{
+    Lines.Emplace(Start, End, FLinearColor(Color), MCS_HitboxDebug::LineLifeTime, Thickness, SDPG_World);
+}
+
+void FMCS_HitboxDebugBatch::AddArc(const FVector& Center, const FVector& AxisA, const FVector& AxisB, float Radius, float StartAngle, float EndAngle, int32 Segments, const FColor& Color)
+{
+    Segments = FMath::Max(Segments, 1);
+    const float AngleStep = (EndAngle - StartAngle) / Segments;
+
+    FVector Last = Center + Radius * (AxisA * FMath::Cos(StartAngle) + AxisB * FMath::Sin(StartAngle));
+    for (int32 i = 1; i <= Segments; ++i)
+    {
+        const float Angle = StartAngle + AngleStep * i;
+        const FVector Next = Center + Radius * (AxisA * FMath::Cos(Angle) + AxisB * FMath::Sin(Angle));
+        AddLine(Last, Next, Color);
+        Last = Next;
+    }
+}
+
+void FMCS_HitboxDebugBatch::AddSphere(const FVector& Center, float Radius, const FColor& Color, int32 Segments)
+{
+    // Three great circles
+    AddArc(Center, FVector::XAxisVector, FVector::YAxisVector, Radius, 0.0f, UE_TWO_PI, Segments, Color);
+    AddArc(Center, FVector::XAxisVector, FVector::ZAxisVector, Radius, 0.0f, UE_TWO_PI, Segments, Color);
+    AddArc(Center, FVector::YAxisVector, FVector::ZAxisVector, Radius, 0.0f, UE_TWO_PI, Segments, Color);
+}
+
+void FMCS_HitboxDebugBatch::AddCapsule(const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation, const FColor& Color, int32 Segments)
+{
+    const FVector AxisX = Rotation.GetAxisX();
+    const FVector AxisY = Rotation.GetAxisY();
+    const FVector AxisZ = Rotation.GetAxisZ();
+    const FVector Top = Center + AxisZ * (FMath::Max(HalfHeight, Radius) - Radius);
+    const FVector Bottom = Center - AxisZ * (FMath::Max(HalfHeight, Radius) - Radius);
+
+    // Rings where the caps meet the cylinder, four side lines, and two half circles over each cap
+    AddArc(Top, AxisX, AxisY, Radius, 0.0f, UE_TWO_PI, Segments, Color);
+    AddArc(Bottom, AxisX, AxisY, Radius, 0.0f, UE_TWO_PI, Segments, Color);
+    AddLine(Top + AxisX * Radius, Bottom + AxisX * Radius, Color);
+    AddLine(Top - AxisX * Radius, Bottom - AxisX * Radius, Color);
+    AddLine(Top + AxisY * Radius, Bottom + AxisY * Radius, Color);
+    AddLine(Top - AxisY * Radius, Bottom - AxisY * Radius, Color);
+    AddArc(Top, AxisX, AxisZ, Radius, 0.0f, UE_PI, Segments / 2, Color);
+    AddArc(Top, AxisY, AxisZ, Radius, 0.0f, UE_PI, Segments / 2, Color);
+    AddArc(Bottom, AxisX, -AxisZ, Radius, 0.0f, UE_PI, Segments / 2, Color);
+    AddArc(Bottom, AxisY, -AxisZ, Radius, 0.0f, UE_PI, Segments / 2, Color);
+}
+
+void FMCS_HitboxDebugBatch::Flush(UWorld* World)
+{
+    if (Lines.IsEmpty())
+        return;
+
+    if (World)
+    {
+        if (ULineBatchComponent* LineBatcher = World->GetLineBatcher(UWorld::ELineBatcherType::World))
+        {
+            LineBatcher->DrawLines(Lines);
+        }
+    }
+
+    Lines.Reset();
+}
+
+#endif // MCS_HITBOX_DEBUG_DRAW
@@ -0,0 +1,215 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_CombatSignificanceSubsystem.cpp
+ * Implementation of the combat LOD (significance) world subsystem.
+ */
+
+#include <SubSystems/MCS_CombatSignificanceSubsystem.h>
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include <Components/MCS_CombatCoreComponent.h>
+
+UMCS_CombatSignificanceSubsystem::UMCS_CombatSignificanceSubsystem()
+{
+    // High: hero fight around the camera
+    FMCS_CombatLODSettings& High = TierSettings.AddDefaulted_GetRef();
+    High.MaxDistance = 1500.0f;
+
+    // Medium: nearby fights, fewer substeps and slower ranking
+    FMCS_CombatLODSettings& Medium = TierSettings.AddDefaulted_GetRef();
+    Medium.MaxDistance = 4000.0f;
+    Medium.SubstepCount = 2;
+    Medium.TargetingRefreshInterval = 0.2f;
+
+    // Low: background fights reuse chooser picks and tick the hitbox at 20 Hz
+    FMCS_CombatLODSettings& Low = TierSettings.AddDefaulted_GetRef();
+    Low.MaxDistance = 8000.0f;
+    Low.SubstepCount = 1;
+    Low.bFullChooserScoring = false;
+    Low.TargetingRefreshInterval = 0.5f;
+    Low.TickInterval = 0.05f;
+    Low.bAllowDebugDraw = false;
+
+    // Dormant: everything beyond
+    FMCS_CombatLODSettings& Dormant = TierSettings.AddDefaulted_GetRef();
+    Dormant.MaxDistance = TNumericLimits<float>::Max();
+    Dormant.SubstepCount = 1;
+    Dormant.bFullChooserScoring = false;
+    Dormant.TargetingRefreshInterval = 1.0f;
+    Dormant.TickInterval = 0.1f;
+    Dormant.bAllowDebugDraw = false;
+}
+
+bool UMCS_CombatSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds that cause duplicate ticking/default values.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+TStatId UMCS_CombatSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_CombatSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UMCS_CombatSignificanceSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeSinceLastEvaluation += DeltaTime;
+    if (TimeSinceLastEvaluation >= EvaluationInterval)
+    {
+        UpdateSignificance();
+    }
+}
+
+void UMCS_CombatSignificanceSubsystem::RegisterCombatant(UMCS_CombatCoreComponent* CombatCore)
+{
+    if (!IsValid(CombatCore))
+        return;
+
+    for (const FMCS_CombatSignificanceEntry& Entry : Combatants)
+    {
+        if (Entry.CombatCore.Get() == CombatCore)
+            return;
+    }
+
+    FMCS_CombatSignificanceEntry& NewEntry = Combatants.AddDefaulted_GetRef();
+    NewEntry.CombatCore = CombatCore;
+    ApplyTier(NewEntry, EMCS_CombatLOD::High);
+}
+
+void UMCS_CombatSignificanceSubsystem::UnregisterCombatant(UMCS_CombatCoreComponent* CombatCore)
+{
+    Combatants.RemoveAll([ CombatCore ] (const FMCS_CombatSignificanceEntry& Entry)
+        {
+            return Entry.CombatCore.Get() == CombatCore;
+        });
+}
+
+const FMCS_CombatLODSettings& UMCS_CombatSignificanceSubsystem::GetTierSettings(EMCS_CombatLOD LOD) const
+{
+    static const FMCS_CombatLODSettings DefaultSettings;
+
+    const int32 Index = static_cast<int32>(LOD);
+    return TierSettings.IsValidIndex(Index) ? TierSettings[Index] : DefaultSettings;
+}
+
+void UMCS_CombatSignificanceSubsystem::UpdateSignificance()
+{
+    TimeSinceLastEvaluation = 0.0f;
+
+    Combatants.RemoveAll([ ] (const FMCS_CombatSignificanceEntry& Entry)
+        {
+            return !Entry.CombatCore.IsValid();
+        });
+
+    // No view yet (e.g. a server before players join): leave tiers as they are
+    GatherViews();
+    if (Views.IsEmpty())
+        return;
+
+    const float FarScale = 1.0f - TierHysteresis;
+    const float NearScale = 1.0f + TierHysteresis;
+
+    for (FMCS_CombatSignificanceEntry& Entry : Combatants)
+    {
+        const AActor* Owner = Entry.CombatCore->GetOwner();
+        if (!Owner)
+            continue;
+
+        // Nearest view wins; views that cannot see the combatant count it as farther away
+        const FVector Location = Owner->GetActorLocation();
+        float Distance = TNumericLimits<float>::Max();
+        for (const FViewInfo& View : Views)
+        {
+            const FVector ToCombatant = Location - View.Location;
+            const float ViewDistance = ToCombatant.Size();
+            const bool bOnScreen = ViewDistance <= KINDA_SMALL_NUMBER ||
+                FVector::DotProduct(ToCombatant / ViewDistance, View.Forward) >= View.CosHalfFOV;
+            Distance = FMath::Min(Distance, bOnScreen ? ViewDistance : ViewDistance * OffScreenDistanceScale);
+        }
+
+        // Only move when the combatant is clearly past the boundary in either direction
+        EMCS_CombatLOD NewLOD = Entry.LOD;
+        const EMCS_CombatLOD FartherLOD = ComputeTier(Distance, FarScale);
+        const EMCS_CombatLOD NearerLOD = ComputeTier(Distance, NearScale);
+        if (FartherLOD > Entry.LOD)
+        {
+            NewLOD = FartherLOD;
+        }
+        else if (NearerLOD < Entry.LOD)
+        {
+            NewLOD = NearerLOD;
+        }
+
+        if (NewLOD != Entry.LOD)
+        {
+            if (bDebug)
+            {
+                UE_LOG(LogTemp, Log, TEXT("[MCS_CombatSignificanceSubsystem] %s: combat LOD %s -> %s (%.0f units)."), *Owner->GetName(),
+                    *UEnum::GetValueAsString(Entry.LOD), *UEnum::GetValueAsString(NewLOD), Distance);
+            }
+            ApplyTier(Entry, NewLOD);
+        }
+    }
+}
+
+void UMCS_CombatSignificanceSubsystem::GatherViews()
+{
+    Views.Reset();
+
+    const UWorld* World = GetWorld();
+    if (!World)
+        return;
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC)
+            continue;
+
+        FViewInfo& View = Views.AddDefaulted_GetRef();
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(View.Location, ViewRotation);
+        View.Forward = ViewRotation.Vector();
+
+        // Widen the cone slightly so combatants at the screen edge are not treated as hidden
+        const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.0f;
+        View.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(FMath::Min(FOV * 0.5f + 10.0f, 180.0f)));
+    }
+}
+
+EMCS_CombatLOD UMCS_CombatSignificanceSubsystem::ComputeTier(float Distance, float Scale) const
+{
+    const float ScaledDistance = Distance * Scale;
+    const int32 LastTier = FMath::Min(TierSettings.Num(), static_cast<int32>(EMCS_CombatLOD::Dormant) + 1) - 1;
+
+    for (int32 Tier = 0; Tier < LastTier; ++Tier)
+    {
+        if (ScaledDistance <= TierSettings[Tier].MaxDistance)
+            return static_cast<EMCS_CombatLOD>(Tier);
+    }
+    return static_cast<EMCS_CombatLOD>(FMath::Max(LastTier, 0));
+}
+
+void UMCS_CombatSignificanceSubsystem::ApplyTier(FMCS_CombatSignificanceEntry& Entry, EMCS_CombatLOD LOD) const
+{
+    Entry.LOD = LOD;
+    if (UMCS_CombatCoreComponent* CombatCore = Entry.CombatCore.Get())
+    {
+        CombatCore->ApplyCombatLOD(LOD, GetTierSettings(LOD));
+    }
+}
@@ -0,0 +1,301 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxSweepSubsystem.cpp
+ * Implementation of the per-frame hitbox sweep batch.
+ */
+
+#include <SubSystems/MCS_HitboxSweepSubsystem.h>
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include <Components/MCS_CombatHitboxComponent.h>
+#include <SubSystems/MCS_TargetingSubsystem.h>
+#include <Utils/MCS_CombatMath.h>
+
+bool UMCS_HitboxSweepSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Only create for PIE/Game worlds; ignore Editor worlds that cause duplicate ticking/default values.
+    const UWorld* World = Cast<UWorld>(Outer);
+    return (World && World->IsGameWorld());
+}
+
+TStatId UMCS_HitboxSweepSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_HitboxSweepSubsystem, STATGROUP_Tickables);
+}
+
+void UMCS_HitboxSweepSubsystem::RegisterHitbox(UMCS_CombatHitboxComponent* Hitbox)
+{
+    if (!IsValid(Hitbox))
+        return;
+
+    for (const FMCS_ActiveHitboxEntry& Entry : ActiveHitboxes)
+    {
+        if (Entry.Component.Get() == Hitbox)
+            return;
+    }
+
+    FMCS_ActiveHitboxEntry& NewEntry = ActiveHitboxes.AddDefaulted_GetRef();
+    NewEntry.Component = Hitbox;
+}
+
+void UMCS_HitboxSweepSubsystem::UnregisterHitbox(UMCS_CombatHitboxComponent* Hitbox)
+{
+    ActiveHitboxes.RemoveAll([ Hitbox ] (const FMCS_ActiveHitboxEntry& Entry)
+        {
+            return Entry.Component.Get() == Hitbox;
+        });
+}
+
+void UMCS_HitboxSweepSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    UWorld* World = GetWorld();
+    if (!World)
+        return;
+
+    // 0) Last frame's async sweeps first, so hits reach listeners in the order their sweeps were issued
+    HarvestAsyncSweeps(World);
+
+    ActiveHitboxes.RemoveAll([ ] (const FMCS_ActiveHitboxEntry& Entry)
+        {
+            return !Entry.Component.IsValid() || !Entry.Component->IsDetecting();
+        });
+
+    // 1) Gather: every due component reads its sockets once and appends its substep sweeps
+    Requests.Reset();
+    Hits.Reset();
+    SweptHitboxes.Reset();
+
+    for (FMCS_ActiveHitboxEntry& Entry : ActiveHitboxes)
+    {
+        // Combat LOD can stretch a component's sweep interval; its sweeps then span the whole interval
+        Entry.TimeSinceSweep += DeltaTime;
+        if (Entry.TimeSinceSweep < Entry.Component->GetSweepInterval())
+            continue;
+        Entry.TimeSinceSweep = 0.0f;
+
+        Entry.FirstRequest = Requests.Num();
+        Entry.Component->BuildSweepRequests(Requests);
+        Entry.NumRequests = Requests.Num() - Entry.FirstRequest;
+
+        if (Entry.NumRequests == 0)
+            continue;
+
+        // Async hitboxes leave the synchronous batch and report next frame
+        if (Entry.Component->IsAsyncSweep())
+        {
+            IssueAsyncSweeps(World, Entry);
+            Requests.SetNum(Entry.FirstRequest, EAllowShrinking::No);
+            continue;
+        }
+
+        SweptHitboxes.Add(Entry);
+    }
+
+    // 2) Sweep: the whole batch back to back with shared parameters and result storage.
+    //    Requests are independent, so this is the stage to split across workers if it ever dominates.
+    RunSweeps(World, Requests, Hits, Scratch);
+
+    // 3) Dispatch: each component gets the hits of its own sweeps, in substep order
+    //    (requests carry their window's serial, so hits for a window replaced meanwhile are dropped)
+    for (const FMCS_ActiveHitboxEntry& Entry : SweptHitboxes)
+    {
+        UMCS_CombatHitboxComponent* Component = Entry.Component.Get();
+        if (!Component)
+            continue;
+
+        Component->ProcessSweepHits(TArrayView<const FMCS_HitboxSweepRequest>(Requests.GetData() + Entry.FirstRequest, Entry.NumRequests), Hits);
+    }
+
+    // 4) Hits reach listeners once, after every sweep of the frame (async and sync)
+    FlushHitEvents();
+
+#if MCS_HITBOX_DEBUG_DRAW
+    // 5) One line batcher update for every hitbox drawn this frame
+    DebugBatch.Flush(World);
+#endif
+}
+
+void UMCS_HitboxSweepSubsystem::QueueHitEventFlush(UMCS_CombatHitboxComponent* Hitbox)
+{
+    HitEventSources.AddUnique(Hitbox);
+}
+
+void UMCS_HitboxSweepSubsystem::FlushHitEvents()
+{
+    if (HitEventSources.IsEmpty())
+        return;
+
+    // The frame-wide batch is only assembled when someone listens to it
+    if (OnHitEvents.IsBound())
+    {
+        FrameHitEvents.Reset();
+        for (const TWeakObjectPtr<UMCS_CombatHitboxComponent>& Source : HitEventSources)
+        {
+            if (const UMCS_CombatHitboxComponent* Component = Source.Get())
+            {
+                FrameHitEvents.Append(Component->GetPendingHitEvents());
+            }
+        }
+        OnHitEvents.Broadcast(FrameHitEvents);
+        FrameHitEvents.Reset();
+    }
+
+    // Listeners may start windows that queue again next frame; work from this frame's list
+    for (int32 Index = 0; Index < HitEventSources.Num(); ++Index)
+    {
+        if (UMCS_CombatHitboxComponent* Component = HitEventSources[Index].Get())
+        {
+            Component->FlushHitEvents();
+        }
+    }
+    HitEventSources.Reset();
+}
+
+void UMCS_HitboxSweepSubsystem::IssueAsyncSweeps(UWorld* World, const FMCS_ActiveHitboxEntry& Entry)
+{
+    static const FCollisionObjectQueryParams ObjectQueryParams(ECC_Pawn);
+    const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MCS_HitboxSweepAsync), false);
+
+    FMCS_ActiveHitboxEntry& Pending = PendingAsyncHitboxes.Add_GetRef(Entry);
+    Pending.FirstRequest = PendingAsyncRequests.Num();
+
+    for (int32 Index = Entry.FirstRequest; Index < Entry.FirstRequest + Entry.NumRequests; ++Index)
+    {
+        const FMCS_HitboxSweepRequest& Request = PendingAsyncRequests.Add_GetRef(Requests[Index]);
+        PendingAsyncHandles.Add(World->AsyncSweepByObjectType(
+            EAsyncTraceType::Multi,
+            Request.Start,
+            Request.End,
+            Request.Rotation,
+            ObjectQueryParams,
+            Request.GetShape(),
+            QueryParams));
+    }
+}
+
+void UMCS_HitboxSweepSubsystem::HarvestAsyncSweeps(const UWorld* World)
+{
+    if (PendingAsyncHitboxes.IsEmpty())
+        return;
+
+    // Async trace data only lives for one frame, so everything issued last frame is read now
+    AsyncHits.Reset();
+    FTraceDatum& Datum = AsyncDatum;
+    for (int32 Index = 0; Index < PendingAsyncRequests.Num(); ++Index)
+    {
+        FMCS_HitboxSweepRequest& Request = PendingAsyncRequests[Index];
+        Request.FirstHit = AsyncHits.Num();
+        Request.NumHits = 0;
+
+        if (World->QueryTraceData(PendingAsyncHandles[Index], Datum))
+        {
+            Request.NumHits = Datum.OutHits.Num();
+            AsyncHits.Append(Datum.OutHits);
+        }
+    }
+
+    // Issue order (component order within the frame, then substep order); a window that was
+    // replaced meanwhile drops its late results, an ended one still receives its final sweeps
+    for (const FMCS_ActiveHitboxEntry& Entry : PendingAsyncHitboxes)
+    {
+        UMCS_CombatHitboxComponent* Component = Entry.Component.Get();
+        if (!Component)
+            continue;
+
+        Component->ProcessSweepHits(TArrayView<const FMCS_HitboxSweepRequest>(PendingAsyncRequests.GetData() + Entry.FirstRequest, Entry.NumRequests), AsyncHits);
+    }
+
+    // New async sweeps are only issued by this frame's gather, after the harvest
+    PendingAsyncHitboxes.Reset();
+    PendingAsyncRequests.Reset();
+    PendingAsyncHandles.Reset();
+}
+
+void UMCS_HitboxSweepSubsystem::RunSweeps(const UWorld* World, TArrayView<FMCS_HitboxSweepRequest> SweepRequests, TArray<FHitResult>& OutHits, FMCS_HitboxSweepScratch& Scratch)
+{
+    if (!World || SweepRequests.IsEmpty())
+        return;
+
+    // Owners are skipped when hits are processed, so one parameter set serves every request
+    static const FCollisionObjectQueryParams ObjectQueryParams(ECC_Pawn);
+    static const FCollisionObjectQueryParams WorldQueryParams(ECC_TO_BITFIELD(ECC_WorldStatic) | ECC_TO_BITFIELD(ECC_WorldDynamic));
+    const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MCS_HitboxSweep), false);
+
+    const UMCS_TargetingSubsystem* Targeting = World->GetSubsystem<UMCS_TargetingSubsystem>();
+    TArray<FHitResult>& StepHits = Scratch.StepHits;
+    for (FMCS_HitboxSweepRequest& Request : SweepRequests)
+    {
+        Request.FirstHit = OutHits.Num();
+        Request.NumWorldHits = 0;
+
+        // Combat targets from the snapshot; the scene is only asked about world geometry
+        if (Request.bAnalyticTargets && Targeting)
+        {
+            AppendAnalyticHits(Request, Targeting->GetTargetSnapshot(), Scratch.Contacts, OutHits);
+        }
+
+        if (!Request.bAnalyticTargets || Request.bSweepWorldGeometry)
+        {
+            World->SweepMultiByObjectType(
+                StepHits,
+                Request.Start,
+                Request.End,
+                Request.Rotation,
+                Request.bAnalyticTargets ? WorldQueryParams : ObjectQueryParams,
+                Request.GetShape(),
+                QueryParams
+            );
+            OutHits.Append(StepHits);
+
+            // In analytic mode the scene only returns world geometry, reported apart from combatant hits
+            Request.NumWorldHits = Request.bAnalyticTargets ? StepHits.Num() : 0;
+        }
+
+        Request.NumHits = OutHits.Num() - Request.FirstHit;
+    }
+}
+
+void UMCS_HitboxSweepSubsystem::AppendAnalyticHits(const FMCS_HitboxSweepRequest& Request, const FMCS_TargetSnapshot& Snapshot, TArray<FMCS_CapsuleContact>& Contacts, TArray<FHitResult>& OutHits)
+{
+    Contacts.Reset();
+    MCS_CombatMath::BladeVsUprightCapsules(
+        Request.PrevBladeStart,
+        Request.PrevBladeEnd,
+        Request.BladeStart,
+        Request.BladeEnd,
+        Request.Radius,
+        Snapshot.Locations,
+        Snapshot.CapsuleRadii,
+        Snapshot.CapsuleHalfHeights,
+        Snapshot.Occupied,
+        Contacts);
+
+    // Same fields a sweep would fill for an initial overlap, so listeners cannot tell the paths apart
+    for (const FMCS_CapsuleContact& Contact : Contacts)
+    {
+        AActor* TargetActor = Snapshot.Actors[Contact.Slot].Get();
+        if (!TargetActor)
+            continue;
+
+        FHitResult& Hit = OutHits.Emplace_GetRef(TargetActor, Cast<UPrimitiveComponent>(TargetActor->GetRootComponent()), Contact.SurfacePoint, Contact.Normal);
+        Hit.bStartPenetrating = true;
+        Hit.Location = Contact.BladePoint;
+        Hit.TraceStart = Request.BladeStart;
+        Hit.TraceEnd = Request.BladeEnd;
+        Hit.Time = 0.0f;
+    }
+}
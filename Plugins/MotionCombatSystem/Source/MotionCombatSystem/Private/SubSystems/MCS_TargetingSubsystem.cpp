@@ -20,10 +20,16 @@
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
 #include "GameFramework/Actor.h"
-#include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 #include "CollisionQueryParams.h"
 #include "CollisionShape.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/CollisionProfile.h"
+#include <Components/MCS_CombatCoreComponent.h>
+#include <Utils/MCS_CombatMath.h>
+
+const FName UMCS_TargetingSubsystem::CombatTargetChannelName(TEXT("CombatTarget"));
 
 UMCS_TargetingSubsystem::UMCS_TargetingSubsystem()
 {
@@ -50,19 +56,14 @@ void UMCS_TargetingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
         return;
     }
 
-    // Start recurring scan timer
-    CachedWorld->GetTimerManager().SetTimerForNextTick([ this ] ()
-        {
-            if (IsValid(CachedWorld))
-            {
-                CachedWorld->GetTimerManager().SetTimer(
-                    ScanTimerHandle,
-                    this,
-                    &UMCS_TargetingSubsystem::ScanForTargets,
-                    TargetScanInterval,
-                    true);
-            }
-        });
+    ResolveCombatTargetChannel();
+
+    // Only servers and standalone games validate hits against history
+    if (CachedWorld->GetNetMode() == NM_Client)
+    {
+        bRecordPoseHistory = false;
+    }
+    PoseHistory.Reset(bRecordPoseHistory ? PoseHistoryFrames : 0);
 
     // Start with scanning enabled
     bIsScanningEnabled = true;
@@ -78,6 +79,55 @@ void UMCS_TargetingSubsystem::Deinitialize()
     Super::Deinitialize();
 }
 
+TStatId UMCS_TargetingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMCS_TargetingSubsystem, STATGROUP_Tickables);
+}
+
+void UMCS_TargetingSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (bIsScanningEnabled)
+    {
+        // Start a new cycle once the previous one has finished and the interval elapsed
+        if (MaintenancePhase == EMCS_TargetMaintenancePhase::Idle)
+        {
+            TimeSinceLastScan += DeltaTime;
+            if (ShouldBeginMaintenanceCycle())
+            {
+                BeginMaintenanceCycle();
+            }
+        }
+
+        if (MaintenancePhase != EMCS_TargetMaintenancePhase::Idle)
+        {
+            AdvanceMaintenance(MaintenanceBudgetMicroseconds * 1.0e-6);
+        }
+    }
+
+    // Visibility results from last frame's traces, then the next round-robin batch
+    if (bEnableLineOfSight)
+    {
+        CollectVisibilityTraces();
+        DispatchVisibilityTraces();
+    }
+
+    // Publish positions and distances once for every consumer this frame
+    RefreshSnapshot();
+    UpdateRankings();
+    BroadcastNeighborhoodChanges();
+
+    if (bRecordPoseHistory)
+    {
+        if (PoseHistory.Capacity != PoseHistoryFrames)
+        {
+            PoseHistory.Reset(PoseHistoryFrames);
+        }
+        PoseHistory.Record(CachedWorld ? CachedWorld->GetTimeSeconds() : 0.0, TargetSnapshot);
+    }
+}
+
 FString UMCS_TargetingSubsystem::MakeWorldTag() const
 {
     const UWorld* World = GetWorld();
@@ -114,17 +164,16 @@ void UMCS_TargetingSubsystem::RegisterTarget(AActor* TargetActor)
         return;
     }
 
-    for (const FMCS_TargetInfo& Info : RegisteredTargets)
-    {
-        if (Info.TargetActor == TargetActor)
-            return;
-    }
+    if (TargetSnapshot.FindSlot(TargetActor) != INDEX_NONE)
+        return;
 
-    FMCS_TargetInfo NewTarget;
-    NewTarget.TargetActor = TargetActor;
-    NewTarget.bIsValid = true;
+    // Explicit registrations skip the interface checks, but still carry their team when they have one
+    const FMCS_TargetClassInfo& ClassInfo = GetTargetClassInfo(TargetActor->GetClass());
+    AddTargetToPool(TargetActor, 0.0f, QueryTeamMask(TargetActor, ClassInfo));
 
-    RegisteredTargets.Add(NewTarget);
+    // The new entry is the pool's last; only its own cell changes (a spawn wave stays linear)
+    const int32 NewIndex = RegisteredTargets.Num() - 1;
+    TargetGrid.FindOrAdd(GetGridCell(TargetSnapshot.Locations[RegisteredTargets[NewIndex].TargetSlot])).Add(NewIndex);
 
     if (bDebug)
     {
@@ -132,14 +181,7 @@ void UMCS_TargetingSubsystem::RegisterTarget(AActor* TargetActor)
     }
 
     // Notify listeners that the target list has been updated
-    if (RegisteredTargets.Num() != LastTargetCount)
-    {
-        LastTargetCount = RegisteredTargets.Num();
-        if (OnTargetsUpdated.IsBound())
-        {
-            OnTargetsUpdated.Broadcast(RegisteredTargets, RegisteredTargets.Num());
-        }
-    }
+    BroadcastIfTargetCountChanged();
 }
 
 void UMCS_TargetingSubsystem::UnregisterTarget(AActor* TargetActor)
@@ -147,13 +189,30 @@ void UMCS_TargetingSubsystem::UnregisterTarget(AActor* TargetActor)
     if (!TargetActor)
         return;
 
-    int32 Removed = RegisteredTargets.RemoveAll([ TargetActor ] (const FMCS_TargetInfo& Info)
+    int32 Removed = 0;
+    for (int32 Index = RegisteredTargets.Num() - 1; Index >= 0; --Index)
+    {
+        if (RegisteredTargets[Index].TargetActor == TargetActor)
         {
-            return Info.TargetActor == TargetActor;
-        });
+            RemoveTargetAt(Index);
+            ++Removed;
+        }
+    }
 
     if (Removed > 0)
     {
+        // Grid indices shifted and neighborhoods may still reference the actor
+        for (FMCS_TargetQuerier& Querier : Queriers)
+        {
+            const int32 RemovedFromQuerier = Querier.Neighborhood.RemoveAll([ TargetActor ] (const FMCS_TargetInfo& Info)
+                {
+                    return Info.TargetActor == TargetActor;
+                });
+            Querier.bRankingDirty = true;
+            Querier.bNeighborhoodChanged |= RemovedFromQuerier > 0;
+        }
+        RebuildTargetGrid();
+
         if (bDebug)
         {
             UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Unregistered Target: %s"), *TargetActor->GetName());
@@ -161,6 +220,97 @@ void UMCS_TargetingSubsystem::UnregisterTarget(AActor* TargetActor)
     }
 
     // Notify listeners if any were removed
+    BroadcastIfTargetCountChanged();
+}
+
+void UMCS_TargetingSubsystem::RegisterQuerier(AActor* Instigator, int32 IncludeTeamMask, int32 ExcludeTeamMask, bool bExcludeOwnTeam)
+{
+    if (!IsValid(Instigator))
+        return;
+
+    if (FindQuerier(Instigator))
+    {
+        SetQuerierTeamFilter(Instigator, IncludeTeamMask, ExcludeTeamMask, bExcludeOwnTeam);
+        return;
+    }
+
+    FMCS_TargetQuerier& NewQuerier = Queriers.AddDefaulted_GetRef();
+    NewQuerier.Instigator = Instigator;
+    NewQuerier.LastScanLocation = Instigator->GetActorLocation();
+    NewQuerier.CombatCore = Instigator->FindComponentByClass<UMCS_CombatCoreComponent>();
+    NewQuerier.IncludeTeamMask = IncludeTeamMask;
+    NewQuerier.ExcludeTeamMask = ExcludeTeamMask;
+    NewQuerier.bExcludeOwnTeam = bExcludeOwnTeam;
+    NewQuerier.OwnTeamMask = QueryTeamMask(Instigator, GetTargetClassInfo(Instigator->GetClass()));
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MCS_TargetingSubsystem] Registered Querier: %s"), *Instigator->GetName());
+    }
+}
+
+void UMCS_TargetingSubsystem::UnregisterQuerier(AActor* Instigator)
+{
+    if (!Instigator)
+        return;
+
+    Queriers.RemoveAll([ Instigator ] (const FMCS_TargetQuerier& Querier)
+        {
+            return Querier.Instigator.Get() == Instigator;
+        });
+}
+
+const FMCS_TargetQuerier* UMCS_TargetingSubsystem::FindQuerier(const AActor* Instigator) const
+{
+    if (!Instigator)
+        return nullptr;
+
+    return Queriers.FindByPredicate([ Instigator ] (const FMCS_TargetQuerier& Querier)
+        {
+            return Querier.Instigator.Get() == Instigator;
+        });
+}
+
+const TArray<FMCS_TargetInfo>& UMCS_TargetingSubsystem::GetTargetsForInstigator(AActor* Instigator) const
+{
+    static const TArray<FMCS_TargetInfo> EmptyTargets;
+
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    return Querier ? Querier->Neighborhood : EmptyTargets;
+}
+
+AActor* UMCS_TargetingSubsystem::GetClosestTargetForInstigator(AActor* Instigator, float MaxRange, float LookaheadTime) const
+{
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    if (!Querier)
+        return nullptr;
+
+    AActor* ClosestActor = nullptr;
+    float ClosestDistance = MaxRange;
+    const FVector InstigatorLocation = Instigator->GetActorLocation();
+
+    // Neighborhood distances are already relative to this instigator; predicted ones are measured from its current location
+    for (const FMCS_TargetInfo& Info : Querier->Neighborhood)
+    {
+        if (!IsValid(Info.TargetActor) || !TargetSnapshot.IsSlotValid(Info.TargetSlot))
+            continue;
+
+        const float Distance = LookaheadTime > 0.0f
+            ? FVector::Dist(InstigatorLocation, TargetSnapshot.Locations[Info.TargetSlot] + TargetSnapshot.Velocities[Info.TargetSlot] * LookaheadTime)
+            : Info.DistanceFromPlayer;
+
+        if (Distance < ClosestDistance)
+        {
+            ClosestDistance = Distance;
+            ClosestActor = Info.TargetActor;
+        }
+    }
+
+    return ClosestActor;
+}
+
+void UMCS_TargetingSubsystem::BroadcastIfTargetCountChanged()
+{
     if (RegisteredTargets.Num() != LastTargetCount)
     {
         LastTargetCount = RegisteredTargets.Num();
@@ -173,199 +323,1360 @@ void UMCS_TargetingSubsystem::UnregisterTarget(AActor* TargetActor)
 
 void UMCS_TargetingSubsystem::CleanupInvalidTargets()
 {
-    RegisteredTargets.RemoveAll([ ] (const FMCS_TargetInfo& Info)
+    for (int32 Index = RegisteredTargets.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsValid(RegisteredTargets[Index].TargetActor))
         {
-            return !IsValid(Info.TargetActor);
-        });
+            RemoveTargetAt(Index);
+        }
+    }
 }
 
 void UMCS_TargetingSubsystem::ScanForTargets()
 {
-    UWorld* World = CachedWorld.Get();
-    if (!World) return;
+    // Restart from a fresh overlap and finish the whole cycle this frame
+    BeginMaintenanceCycle();
+    AdvanceMaintenance(-1.0);
+}
 
-    APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
-    if (!IsValid(PlayerPawn))
-        return;
+bool UMCS_TargetingSubsystem::ShouldBeginMaintenanceCycle() const
+{
+    if (!bAdaptiveScanInterval)
+        return TimeSinceLastScan >= TargetScanInterval;
 
-    const FVector PlayerLocation = PlayerPawn->GetActorLocation();
+    if (TimeSinceLastScan < MinTargetScanInterval)
+        return false;
 
-    // Clean up dead targets AND those now out of range
-    CleanupInvalidTargets();
-    RemoveOutOfRangeTargets(PlayerLocation);
+    // Nobody registered yet: keep the base rate so local players get picked up
+    if (Queriers.IsEmpty())
+        return TimeSinceLastScan >= TargetScanInterval;
 
-    // Use a sphere overlap instead of scanning all actors in the world. Much more efficient.
-    TArray<FOverlapResult> Overlaps;
-    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MCS_TargetScan), false);
-    FCollisionObjectQueryParams ObjectQueryParams(FCollisionObjectQueryParams::AllDynamicObjects);
+    const float RescanDistanceSq = FMath::Square(ScanRadius * RescanDistanceFraction);
+    float MaxSpeed = 0.0f;
+
+    for (const FMCS_TargetQuerier& Querier : Queriers)
+    {
+        const AActor* Instigator = Querier.Instigator.Get();
+        if (!IsValid(Instigator))
+            continue;
 
-    const FCollisionShape SphereShape = FCollisionShape::MakeSphere(ScanRadius);
+        // Travelled far enough that the neighborhood is likely stale
+        if (FVector::DistSquared(Instigator->GetActorLocation(), Querier.LastScanLocation) >= RescanDistanceSq)
+            return true;
 
-    World->OverlapMultiByObjectType(
-        Overlaps,
-        PlayerLocation,
-        FQuat::Identity,
-        ObjectQueryParams,
-        SphereShape,
-        QueryParams);
+        // Mid-attack: the chooser and combo follow-ups need fresh membership
+        const UMCS_CombatCoreComponent* CombatCore = Querier.CombatCore.Get();
+        if (CombatCore && CombatCore->IsAttacking())
+            return true;
 
-    // Visualization for debugging if enabled
-    if (bDebug)
+        MaxSpeed = FMath::Max(MaxSpeed, static_cast<float>(Instigator->GetVelocity().Size()));
+    }
+
+    // Idle queriers only need to notice targets walking in, so stretch to the max interval
+    if (MaxSpeed < IdleSpeedThreshold)
+        return TimeSinceLastScan >= MaxTargetScanInterval;
+
+    // Moving: shorten linearly from the base interval towards the minimum as speed rises
+    const float SpeedAlpha = FMath::Clamp(MaxSpeed / ScanReferenceSpeed, 0.0f, 1.0f);
+    const float Interval = FMath::Lerp(TargetScanInterval, MinTargetScanInterval, SpeedAlpha);
+    return TimeSinceLastScan >= Interval;
+}
+
+void UMCS_TargetingSubsystem::BeginMaintenanceCycle()
+{
+    UWorld* World = CachedWorld.Get();
+    if (!World) return;
+
+    TimeSinceLastScan = 0.0f;
+
+    // Nothing registered yet: fall back to local players so Blueprint-only setups keep working
+    if (Queriers.IsEmpty())
     {
-        DrawDebugSphere(World, PlayerLocation, ScanRadius, 16, FColor::Red, false, 0.25f);
+        RegisterLocalPlayerQueriers();
     }
 
-    // Convert results to actor list
-    TArray<AActor*> FoundActors;
-    FoundActors.Reserve(Overlaps.Num());
-    for (const FOverlapResult& Result : Overlaps)
+    GatherQuerierLocations(CycleQuerierLocations);
+    if (CycleQuerierLocations.IsEmpty())
     {
-        if (AActor* HitActor = Result.GetActor())
-        {
-            FoundActors.Add(HitActor);
-        }
+        MaintenancePhase = EMCS_TargetMaintenancePhase::Idle;
+        return;
     }
 
-    // Process each found actor to determine if we should add them to our target list
-    for (AActor* Actor : FoundActors)
+    for (int32 Index = 0; Index < Queriers.Num(); ++Index)
     {
-        if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
-            continue;
+        Queriers[Index].LastScanLocation = CycleQuerierLocations[Index];
+    }
 
-        // Ignore player pawn
-        if (Actor == UGameplayStatics::GetPlayerPawn(World, 0))
-            continue;
+    // Overlap once per querier cluster instead of scanning all actors in the world. Much more efficient.
+    TArray<AActor*> FoundActors;
+    GatherCandidates(World, CycleQuerierLocations, FoundActors);
 
-        // Must implement the MCS combat target interface
-        if (!Actor->Implements<UMCS_CombatTargetInterface>())
-            continue;
+    PendingCandidates.Reset(FoundActors.Num());
+    for (AActor* Actor : FoundActors)
+    {
+        PendingCandidates.Add(Actor);
+    }
 
-        // Ask the actor if it can currently be targeted
-        if (!IMCS_CombatTargetInterface::Execute_CanBeTargeted(Actor))
-            continue;
+    MaintenancePhase = EMCS_TargetMaintenancePhase::RefreshTargets;
+    MaintenanceCursor = 0;
+}
 
-        const float Distance = FVector::Dist(PlayerLocation, Actor->GetActorLocation());
-        if (Distance > ScanRadius)
-            continue;
+void UMCS_TargetingSubsystem::AdvanceMaintenance(double BudgetSeconds)
+{
+    const bool bUnbounded = BudgetSeconds < 0.0;
+    const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+    int32 ItemsProcessed = 0;
 
-        // Avoid duplicates
-        bool bAlreadyRegistered = false;
-        for (const FMCS_TargetInfo& Info : RegisteredTargets)
+    auto HasBudget = [ & ] ()
         {
-            if (Info.TargetActor == Actor)
-            {
-                bAlreadyRegistered = true;
-                break;
-            }
-        }
+            return bUnbounded || ItemsProcessed < MinMaintenanceSliceSize || FPlatformTime::Seconds() < Deadline;
+        };
 
-        if (!bAlreadyRegistered)
+    while (MaintenancePhase != EMCS_TargetMaintenancePhase::Idle && HasBudget())
+    {
+        switch (MaintenancePhase)
         {
-            FMCS_TargetInfo NewTarget;
-            NewTarget.TargetActor = Actor;
-            NewTarget.DistanceFromPlayer = Distance;
-            NewTarget.bIsValid = true;
-            RegisteredTargets.Add(NewTarget);
+            case EMCS_TargetMaintenancePhase::RefreshTargets:
+                if (MaintenanceCursor >= RegisteredTargets.Num())
+                {
+                    MaintenancePhase = EMCS_TargetMaintenancePhase::FilterCandidates;
+                    MaintenanceCursor = 0;
+                    break;
+                }
 
-            if (bDebug)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Added Target: %s"), *Actor->GetName());
-            }
+                // Removed entries are swapped with the tail, so only advance when the entry stays
+                if (RefreshTargetAt(MaintenanceCursor))
+                {
+                    ++MaintenanceCursor;
+                }
+                ++ItemsProcessed;
+                break;
+
+            case EMCS_TargetMaintenancePhase::FilterCandidates:
+                if (MaintenanceCursor >= PendingCandidates.Num())
+                {
+                    MaintenancePhase = EMCS_TargetMaintenancePhase::Commit;
+                    break;
+                }
+
+                FilterCandidate(PendingCandidates[MaintenanceCursor++].Get());
+                ++ItemsProcessed;
+                break;
+
+            case EMCS_TargetMaintenancePhase::Commit:
+                CommitMaintenanceCycle();
+                ++ItemsProcessed;
+                break;
+
+            default:
+                MaintenancePhase = EMCS_TargetMaintenancePhase::Idle;
+                break;
         }
     }
+}
 
-    if (bDebug)
+float UMCS_TargetingSubsystem::GetNearestQuerierDistanceSq(const FVector& Location) const
+{
+    float NearestDistanceSq = TNumericLimits<float>::Max();
+    for (const FVector& QuerierLocation : CycleQuerierLocations)
     {
-        if (bDebug)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Scanned %d valid targets within %.0f units."), RegisteredTargets.Num(), ScanRadius);
-        }
+        NearestDistanceSq = FMath::Min(NearestDistanceSq, static_cast<float>(FVector::DistSquared(QuerierLocation, Location)));
     }
+    return NearestDistanceSq;
+}
 
-    // Notify listeners that the target list has been updated
-    if (RegisteredTargets.Num() != LastTargetCount)
+bool UMCS_TargetingSubsystem::RefreshTargetAt(int32 Index)
+{
+    FMCS_TargetInfo& Info = RegisteredTargets[Index];
+
+    // Remove dead targets AND those now out of range of every querier (location comes from the snapshot)
+    bool bKeep = IsValid(Info.TargetActor) && !Info.TargetActor->IsActorBeingDestroyed() && TargetSnapshot.IsSlotValid(Info.TargetSlot);
+    if (bKeep)
     {
-        LastTargetCount = RegisteredTargets.Num();
-        if (OnTargetsUpdated.IsBound())
-        {
-            OnTargetsUpdated.Broadcast(RegisteredTargets, RegisteredTargets.Num());
-        }
+        // Hysteresis: tracked targets only leave past the exit radius, and never before their residency time
+        const float NearestDistanceSq = GetNearestQuerierDistanceSq(TargetSnapshot.Locations[Info.TargetSlot]);
+        bKeep = NearestDistanceSq <= FMath::Square(GetExitRadius()) || IsWithinResidency(Info.EnteredTime, GetWorldTimeSeconds());
+        Info.DistanceFromPlayer = FMath::Sqrt(NearestDistanceSq);
+    }
+
+    // Nobody may target this team any more (querier filters changed or the only interested querier left)
+    bKeep = bKeep && IsTeamWantedByAnyQuerier(Info.TeamMask);
+
+    if (!bKeep)
+    {
+        RemoveTargetAt(Index);
     }
+    return bKeep;
 }
 
-AActor* UMCS_TargetingSubsystem::GetClosestTarget(const FVector& FromLocation, float MaxRange) const
+void UMCS_TargetingSubsystem::RemoveTargetAt(int32 Index)
 {
-    AActor* ClosestActor = nullptr;
-    float ClosestDistanceSq = MaxRange * MaxRange;
+    ReleaseTargetSlot(RegisteredTargets[Index]);
 
-    for (const FMCS_TargetInfo& Info : RegisteredTargets)
+    // Mid refresh pass: entries below the cursor are done. Move the last done entry into the hole first, so the
+    // unvisited tail entry swapped in below lands at the cursor instead of among the done ones.
+    if (MaintenancePhase == EMCS_TargetMaintenancePhase::RefreshTargets && Index < MaintenanceCursor)
     {
-        if (!IsValid(Info.TargetActor))
-            continue;
-
-        const float DistSq = FVector::DistSquared(FromLocation, Info.TargetActor->GetActorLocation());
-        if (DistSq < ClosestDistanceSq)
-        {
-            ClosestDistanceSq = DistSq;
-            ClosestActor = Info.TargetActor;
-        }
+        --MaintenanceCursor;
+        RegisteredTargets.Swap(Index, MaintenanceCursor);
+        Index = MaintenanceCursor;
     }
 
-    return ClosestActor;
+    RegisteredTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 }
 
-void UMCS_TargetingSubsystem::RemoveOutOfRangeTargets(const FVector& FromLocation)
+void UMCS_TargetingSubsystem::FilterCandidate(AActor* Actor)
 {
-    if (RegisteredTargets.Num() == 0)
+    if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+        return;
+
+    // Avoid duplicates
+    if (TargetSnapshot.FindSlot(Actor) != INDEX_NONE)
+        return;
+
+    // Must implement the MCS combat target interface (answered once per class)
+    const FMCS_TargetClassInfo& ClassInfo = GetTargetClassInfo(Actor->GetClass());
+    if (!ClassInfo.bImplementsInterface)
         return;
 
-    RegisteredTargets.RemoveAll([ this, &FromLocation ] (const FMCS_TargetInfo& Info)
+    // Ask the actor if it can currently be targeted
+    if (!QueryCanBeTargeted(Actor, ClassInfo))
+        return;
+
+    // Allies of every querier never enter the pool
+    const int32 TeamMask = QueryTeamMask(Actor, ClassInfo);
+    if (!IsTeamWantedByAnyQuerier(TeamMask))
+        return;
+
+    // Must be inside ScanRadius of at least one querier
+    const float NearestDistanceSq = GetNearestQuerierDistanceSq(Actor->GetActorLocation());
+    if (NearestDistanceSq > FMath::Square(ScanRadius))
+        return;
+
+    AddTargetToPool(Actor, FMath::Sqrt(NearestDistanceSq), TeamMask);
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Added Target: %s"), *Actor->GetName());
+    }
+}
+
+void UMCS_TargetingSubsystem::CommitMaintenanceCycle()
+{
+    // Queriers may have come or gone while the cycle was spread over frames
+    TArray<FVector> QuerierLocations;
+    GatherQuerierLocations(QuerierLocations);
+
+    // One structure update, then a cheap grid query per querier
+    RebuildTargetGrid();
+    BuildNeighborhoods(QuerierLocations);
+
+    PendingCandidates.Reset();
+    MaintenancePhase = EMCS_TargetMaintenancePhase::Idle;
+
+    // Drop pushed state of destroyed actors
+    for (auto It = PushedTargetability.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (auto It = PushedTeamMasks.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
         {
-            if (!IsValid(Info.TargetActor))
-                return true; // Remove invalids
+            It.RemoveCurrent();
+        }
+    }
 
-            const float Distance = FVector::Dist(FromLocation, Info.TargetActor->GetActorLocation());
-            return Distance > ScanRadius; // Remove if too far
-        });
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Scanned %d valid targets for %d queriers within %.0f units."),
+            RegisteredTargets.Num(), QuerierLocations.Num(), ScanRadius);
+    }
+
+    // Notify listeners that the target list has been updated
+    BroadcastIfTargetCountChanged();
 }
 
-void UMCS_TargetingSubsystem::SetTargetScanningEnabled(bool bEnable)
+void UMCS_TargetingSubsystem::RegisterLocalPlayerQueriers()
 {
-    if (!IsValid(CachedWorld))
+    UWorld* World = CachedWorld.Get();
+    if (!World) return;
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
     {
-        if (bDebug)
+        const APlayerController* PC = It->Get();
+        if (PC && PC->IsLocalController())
         {
-            UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Cannot toggle scanning — no valid world."));
+            RegisterQuerier(PC->GetPawn());
         }
-        return;
     }
+}
 
-    if (bIsScanningEnabled == bEnable)
+void UMCS_TargetingSubsystem::GatherQuerierLocations(TArray<FVector>& OutLocations)
+{
+    Queriers.RemoveAll([ ] (const FMCS_TargetQuerier& Querier)
+        {
+            return !Querier.Instigator.IsValid() || Querier.Instigator->IsActorBeingDestroyed();
+        });
+
+    OutLocations.Reset(Queriers.Num());
+    for (const FMCS_TargetQuerier& Querier : Queriers)
     {
-        // No change
-        return;
+        OutLocations.Add(Querier.Instigator->GetActorLocation());
     }
+}
 
-    bIsScanningEnabled = bEnable;
+void UMCS_TargetingSubsystem::GatherCandidates(UWorld* World, const TArray<FVector>& QuerierLocations, TArray<AActor*>& OutCandidates) const
+{
+    // Bucket queriers into cells twice the scan radius wide; each bucket costs a single overlap
+    const float ClusterSize = FMath::Max(ScanRadius * 2.0f, 1.0f);
+    TMap<FIntPoint, FBox> Clusters;
+    for (const FVector& Location : QuerierLocations)
+    {
+        const FIntPoint Key(FMath::FloorToInt(Location.X / ClusterSize), FMath::FloorToInt(Location.Y / ClusterSize));
+        Clusters.FindOrAdd(Key, FBox(ForceInit)) += Location;
+    }
+
+    // Let the broadphase drop props, debris and projectiles instead of the interface check
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MCS_TargetScan), false);
+    const FCollisionObjectQueryParams ObjectQueryParams = MakeScanObjectQueryParams();
+    const bool bUseProfile = !ScanQueryProfile.IsNone();
 
-    FTimerManager& TimerMgr = CachedWorld->GetTimerManager();
+    TArray<FOverlapResult> Overlaps;
+    TSet<AActor*> Seen;
+    for (const TPair<FIntPoint, FBox>& Cluster : Clusters)
+    {
+        const FVector Center = Cluster.Value.GetCenter();
+        const float Radius = ScanRadius + Cluster.Value.GetExtent().Size();
+
+        Overlaps.Reset();
+        if (bUseProfile)
+        {
+            World->OverlapMultiByProfile(
+                Overlaps,
+                Center,
+                FQuat::Identity,
+                ScanQueryProfile,
+                FCollisionShape::MakeSphere(Radius),
+                QueryParams);
+        }
+        else
+        {
+            World->OverlapMultiByObjectType(
+                Overlaps,
+                Center,
+                FQuat::Identity,
+                ObjectQueryParams,
+                FCollisionShape::MakeSphere(Radius),
+                QueryParams);
+        }
+
+        // Visualization for debugging if enabled
+        if (bDebug)
+        {
+            DrawDebugSphere(World, Center, Radius, 16, FColor::Red, false, 0.25f);
+        }
+
+        // Convert results to a unique actor list
+        for (const FOverlapResult& Result : Overlaps)
+        {
+            AActor* HitActor = Result.GetActor();
+            bool bAlreadySeen = false;
+            if (HitActor)
+            {
+                Seen.Add(HitActor, &bAlreadySeen);
+                if (!bAlreadySeen)
+                {
+                    OutCandidates.Add(HitActor);
+                }
+            }
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::ResolveCombatTargetChannel()
+{
+    CombatTargetChannel = ECC_MAX;
+
+    const UCollisionProfile* CollisionProfile = UCollisionProfile::Get();
+    for (int32 Channel = ECC_GameTraceChannel1; Channel <= ECC_GameTraceChannel18; ++Channel)
+    {
+        if (CollisionProfile->ReturnChannelNameFromContainerIndex(Channel) == CombatTargetChannelName)
+        {
+            CombatTargetChannel = static_cast<ECollisionChannel>(Channel);
+            return;
+        }
+    }
+
+    if (TargetObjectTypes.IsEmpty() && ScanQueryProfile.IsNone())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] No '%s' object channel defined in the project's collision settings. Scans fall back to all dynamic objects."),
+            *CombatTargetChannelName.ToString());
+    }
+}
+
+FCollisionObjectQueryParams UMCS_TargetingSubsystem::MakeScanObjectQueryParams() const
+{
+    if (!TargetObjectTypes.IsEmpty())
+        return FCollisionObjectQueryParams(TargetObjectTypes);
+
+    if (CombatTargetChannel != ECC_MAX)
+        return FCollisionObjectQueryParams(CombatTargetChannel.GetValue());
+
+    return FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllDynamicObjects);
+}
+
+FIntPoint UMCS_TargetingSubsystem::GetGridCell(const FVector& Location) const
+{
+    const float CellSize = FMath::Max(ScanRadius, 1.0f);
+    return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UMCS_TargetingSubsystem::RebuildTargetGrid()
+{
+    TargetGrid.Reset();
+
+    for (int32 Index = 0; Index < RegisteredTargets.Num(); ++Index)
+    {
+        const int32 Slot = RegisteredTargets[Index].TargetSlot;
+        if (TargetSnapshot.IsSlotValid(Slot))
+        {
+            TargetGrid.FindOrAdd(GetGridCell(TargetSnapshot.Locations[Slot])).Add(Index);
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::QueryTargetGrid(const FVector& Center, float Radius, TArray<int32>& OutIndices) const
+{
+    const FIntPoint MinCell = GetGridCell(Center - FVector(Radius));
+    const FIntPoint MaxCell = GetGridCell(Center + FVector(Radius));
+
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            if (const TArray<int32>* Cell = TargetGrid.Find(FIntPoint(X, Y)))
+            {
+                OutIndices.Append(*Cell);
+            }
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::BuildNeighborhoods(const TArray<FVector>& QuerierLocations)
+{
+    check(QuerierLocations.Num() == Queriers.Num());
+
+    // Pool entries report the distance to the nearest querier
+    for (FMCS_TargetInfo& Info : RegisteredTargets)
+    {
+        Info.DistanceFromPlayer = TNumericLimits<float>::Max();
+    }
+
+    const float EnterRadiusSq = FMath::Square(ScanRadius);
+    const float ExitRadiusSq = FMath::Square(GetExitRadius());
+    const float Now = GetWorldTimeSeconds();
+    TArray<int32> CellIndices;
+
+    // Entry time of each slot in the querier's previous neighborhood (negative = was not a member). Filled once;
+    // each querier only writes and then clears its own previous members, so the commit stays O(slots + members).
+    TArray<float> PreviousEnteredTime;
+    PreviousEnteredTime.Init(-1.0f, TargetSnapshot.Num());
+    TArray<int32> PreviousSlots;
+
+    for (int32 QuerierIndex = 0; QuerierIndex < Queriers.Num(); ++QuerierIndex)
+    {
+        FMCS_TargetQuerier& Querier = Queriers[QuerierIndex];
+        const FVector& QuerierLocation = QuerierLocations[QuerierIndex];
+        const AActor* Instigator = Querier.Instigator.Get();
+        Querier.bRankingDirty = true;
+
+        PreviousSlots.Reset();
+        for (const FMCS_TargetInfo& OldInfo : Querier.Neighborhood)
+        {
+            if (IsSlotOwnedBy(OldInfo.TargetSlot, OldInfo.TargetActor) && PreviousEnteredTime[OldInfo.TargetSlot] < 0.0f)
+            {
+                PreviousEnteredTime[OldInfo.TargetSlot] = OldInfo.EnteredTime;
+                PreviousSlots.Add(OldInfo.TargetSlot);
+            }
+        }
+
+        // Residents may sit anywhere inside the exit radius, so query that far
+        CellIndices.Reset();
+        QueryTargetGrid(QuerierLocation, GetExitRadius(), CellIndices);
+
+        Querier.Neighborhood.Reset();
+        int32 NumRetained = 0;
+        for (const int32 TargetIndex : CellIndices)
+        {
+            FMCS_TargetInfo& PoolInfo = RegisteredTargets[TargetIndex];
+
+            // A combatant is never its own target
+            if (PoolInfo.TargetActor == Instigator)
+                continue;
+
+            // Team filter on the packed mask, before any distance math
+            if (!Querier.AcceptsTeamMask(TargetSnapshot.TeamMasks[PoolInfo.TargetSlot]))
+                continue;
+
+            // New members need the enter radius; existing ones stay until the exit radius or residency expires
+            const float DistSq = FVector::DistSquared(QuerierLocation, TargetSnapshot.Locations[PoolInfo.TargetSlot]);
+            const float EnteredTime = PreviousEnteredTime[PoolInfo.TargetSlot];
+            const bool bWasMember = EnteredTime >= 0.0f;
+            const bool bKeep = DistSq <= EnterRadiusSq ||
+                (bWasMember && (DistSq <= ExitRadiusSq || IsWithinResidency(EnteredTime, Now)));
+            if (!bKeep)
+                continue;
+
+            const float Distance = FMath::Sqrt(DistSq);
+            PoolInfo.DistanceFromPlayer = FMath::Min(PoolInfo.DistanceFromPlayer, Distance);
+
+            FMCS_TargetInfo& LocalInfo = Querier.Neighborhood.Add_GetRef(PoolInfo);
+            LocalInfo.DistanceFromPlayer = Distance;
+            LocalInfo.EnteredTime = bWasMember ? EnteredTime : Now;
+            NumRetained += bWasMember ? 1 : 0;
+        }
+
+        // Membership changed if anyone left (fewer retained than before) or joined (more members than retained)
+        Querier.bNeighborhoodChanged |= NumRetained != PreviousSlots.Num() || Querier.Neighborhood.Num() != NumRetained;
+
+        for (const int32 Slot : PreviousSlots)
+        {
+            PreviousEnteredTime[Slot] = -1.0f;
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::BroadcastNeighborhoodChanges()
+{
+    // Only combatants whose own neighborhood gained or lost members hear about it.
+    // Index loop: a listener may register or unregister queriers.
+    for (int32 QuerierIndex = 0; QuerierIndex < Queriers.Num(); ++QuerierIndex)
+    {
+        FMCS_TargetQuerier& Querier = Queriers[QuerierIndex];
+        if (!Querier.bNeighborhoodChanged)
+            continue;
+
+        Querier.bNeighborhoodChanged = false;
+        if (UMCS_CombatCoreComponent* Core = Querier.CombatCore.Get())
+        {
+            Core->HandleNeighborhoodChanged();
+        }
+    }
+}
+
+AActor* UMCS_TargetingSubsystem::GetClosestTarget(const FVector& FromLocation, float MaxRange, float LookaheadTime,
+    int32 IncludeTeamMask, int32 ExcludeTeamMask) const
+{
+    AActor* ClosestActor = nullptr;
+    float ClosestDistanceSq = MaxRange * MaxRange;
+    const float Lookahead = FMath::Max(LookaheadTime, 0.0f);
+
+    for (const FMCS_TargetInfo& Info : RegisteredTargets)
+    {
+        if (!TargetSnapshot.IsSlotValid(Info.TargetSlot) || !IsValid(Info.TargetActor))
+            continue;
+
+        if (!FMCS_TargetQuerier::PassesTeamFilter(TargetSnapshot.TeamMasks[Info.TargetSlot], IncludeTeamMask, ExcludeTeamMask))
+            continue;
+
+        // Extrapolate along the snapshot velocity (Lookahead 0 = current position)
+        const FVector Predicted = TargetSnapshot.Locations[Info.TargetSlot] + TargetSnapshot.Velocities[Info.TargetSlot] * Lookahead;
+        const float DistSq = FVector::DistSquared(FromLocation, Predicted);
+        if (DistSq < ClosestDistanceSq)
+        {
+            ClosestDistanceSq = DistSq;
+            ClosestActor = Info.TargetActor;
+        }
+    }
+
+    return ClosestActor;
+}
+
+const FMCS_TargetClassInfo& UMCS_TargetingSubsystem::GetTargetClassInfo(const UClass* ActorClass)
+{
+    if (const FMCS_TargetClassInfo* Cached = TargetClassCache.Find(ActorClass))
+        return *Cached;
+
+    FMCS_TargetClassInfo Info;
+    Info.bImplementsInterface = ActorClass->ImplementsInterface(UMCS_CombatTargetInterface::StaticClass());
+
+    if (Info.bImplementsInterface)
+    {
+        // Native implementers whose functions resolve to native UFunctions can skip ProcessEvent
+        const bool bNativeInterface = ActorClass->GetDefaultObject()->GetInterfaceAddress(UMCS_CombatTargetInterface::StaticClass()) != nullptr;
+        auto IsNativeCall = [ ActorClass, bNativeInterface ] (FName FunctionName)
+            {
+                const UFunction* Function = ActorClass->FindFunctionByName(FunctionName);
+                const bool bBlueprintOverride = Function && !Function->GetOuterUClass()->HasAnyClassFlags(CLASS_Native);
+                return bNativeInterface && !bBlueprintOverride;
+            };
+
+        Info.bNativeCanBeTargeted = IsNativeCall(GET_FUNCTION_NAME_CHECKED(IMCS_CombatTargetInterface, CanBeTargeted));
+        Info.bNativeGetCombatTeamMask = IsNativeCall(GET_FUNCTION_NAME_CHECKED(IMCS_CombatTargetInterface, GetCombatTeamMask));
+    }
+
+    return TargetClassCache.Add(ActorClass, Info);
+}
+
+bool UMCS_TargetingSubsystem::QueryCanBeTargeted(AActor* Actor, const FMCS_TargetClassInfo& ClassInfo) const
+{
+    if (const bool* Pushed = PushedTargetability.Find(Actor))
+        return *Pushed;
+
+    if (ClassInfo.bNativeCanBeTargeted)
+    {
+        const IMCS_CombatTargetInterface* Target = CastChecked<IMCS_CombatTargetInterface>(Actor);
+        return Target->CanBeTargeted_Implementation();
+    }
+
+    return IMCS_CombatTargetInterface::Execute_CanBeTargeted(Actor);
+}
+
+int32 UMCS_TargetingSubsystem::QueryTeamMask(AActor* Actor, const FMCS_TargetClassInfo& ClassInfo) const
+{
+    if (const int32* Pushed = PushedTeamMasks.Find(Actor))
+        return *Pushed;
+
+    if (!ClassInfo.bImplementsInterface)
+        return 0;
+
+    if (ClassInfo.bNativeGetCombatTeamMask)
+    {
+        const IMCS_CombatTargetInterface* Target = CastChecked<IMCS_CombatTargetInterface>(Actor);
+        return Target->GetCombatTeamMask_Implementation();
+    }
+
+    return IMCS_CombatTargetInterface::Execute_GetCombatTeamMask(Actor);
+}
+
+bool UMCS_TargetingSubsystem::IsTeamWantedByAnyQuerier(int32 TeamMask) const
+{
+    // Without queriers there is nothing to filter for yet
+    if (Queriers.IsEmpty())
+        return true;
+
+    for (const FMCS_TargetQuerier& Querier : Queriers)
+    {
+        if (Querier.AcceptsTeamMask(TeamMask))
+            return true;
+    }
+    return false;
+}
+
+void UMCS_TargetingSubsystem::SetQuerierTeamFilter(AActor* Instigator, int32 IncludeTeamMask, int32 ExcludeTeamMask, bool bExcludeOwnTeam)
+{
+    FMCS_TargetQuerier* Querier = FindQuerierMutable(Instigator);
+    if (!Querier)
+        return;
+
+    Querier->IncludeTeamMask = IncludeTeamMask;
+    Querier->ExcludeTeamMask = ExcludeTeamMask;
+    Querier->bExcludeOwnTeam = bExcludeOwnTeam;
+    Querier->OwnTeamMask = QueryTeamMask(Instigator, GetTargetClassInfo(Instigator->GetClass()));
+    DropRejectedNeighbors(*Querier);
+}
+
+void UMCS_TargetingSubsystem::DropRejectedNeighbors(FMCS_TargetQuerier& Querier)
+{
+    // Newly accepted teams join on the next scan; rejected ones leave now
+    const int32 Removed = Querier.Neighborhood.RemoveAll([ &Querier ] (const FMCS_TargetInfo& Info)
+        {
+            return !Querier.AcceptsTeamMask(Info.TeamMask);
+        });
+    Querier.bRankingDirty |= Removed > 0;
+    Querier.bNeighborhoodChanged |= Removed > 0;
+}
+
+void UMCS_TargetingSubsystem::SetQuerierRefreshInterval(AActor* Instigator, float RefreshInterval)
+{
+    if (FMCS_TargetQuerier* Querier = FindQuerierMutable(Instigator))
+    {
+        Querier->RankingRefreshInterval = FMath::Max(RefreshInterval, 0.0f);
+        Querier->NextRankingTime = FMath::Min(Querier->NextRankingTime, GetWorldTimeSeconds() + Querier->RankingRefreshInterval);
+    }
+}
+
+void UMCS_TargetingSubsystem::SetTargetTeamMask(AActor* TargetActor, int32 TeamMask)
+{
+    if (!IsValid(TargetActor))
+        return;
+
+    PushedTeamMasks.Add(TargetActor, TeamMask);
+
+    // A combatant that changed sides stops excluding its old team and starts excluding the new one
+    if (FMCS_TargetQuerier* OwnQuerier = FindQuerierMutable(TargetActor))
+    {
+        OwnQuerier->OwnTeamMask = TeamMask;
+        DropRejectedNeighbors(*OwnQuerier);
+    }
+
+    const int32 Slot = TargetSnapshot.FindSlot(TargetActor);
+    if (!TargetSnapshot.IsSlotValid(Slot))
+        return;
+
+    if (!IsTeamWantedByAnyQuerier(TeamMask))
+    {
+        UnregisterTarget(TargetActor);
+        return;
+    }
+
+    TargetSnapshot.TeamMasks[Slot] = TeamMask;
+    for (FMCS_TargetInfo& Info : RegisteredTargets)
+    {
+        if (Info.TargetSlot == Slot)
+        {
+            Info.TeamMask = TeamMask;
+            break;
+        }
+    }
+
+    // Queriers that no longer accept the target drop it now; the others keep their entry up to date
+    for (FMCS_TargetQuerier& Querier : Queriers)
+    {
+        const bool bAccepted = Querier.AcceptsTeamMask(TeamMask);
+        const int32 Removed = Querier.Neighborhood.RemoveAll([ Slot, bAccepted, TeamMask ] (FMCS_TargetInfo& Info)
+            {
+                if (Info.TargetSlot != Slot)
+                    return false;
+
+                Info.TeamMask = TeamMask;
+                return !bAccepted;
+            });
+        Querier.bRankingDirty |= Removed > 0;
+        Querier.bNeighborhoodChanged |= Removed > 0;
+    }
+}
+
+bool UMCS_TargetingSubsystem::IsTeamAllowedForInstigator(const AActor* Instigator, const AActor* TargetActor) const
+{
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    const int32 Slot = TargetSnapshot.FindSlot(TargetActor);
+    if (!Querier || !TargetSnapshot.IsSlotValid(Slot))
+        return true;
+
+    return Querier->AcceptsTeamMask(TargetSnapshot.TeamMasks[Slot]);
+}
+
+void UMCS_TargetingSubsystem::NotifyTargetabilityChanged(AActor* TargetActor, bool bCanBeTargeted)
+{
+    if (!IsValid(TargetActor))
+        return;
+
+    PushedTargetability.Add(TargetActor, bCanBeTargeted);
+
+    if (!bCanBeTargeted)
+    {
+        UnregisterTarget(TargetActor);
+    }
+
+    if (bDebug)
+    {
+        UE_LOG(LogTemp, Log, TEXT("[MCS_TargetingSubsystem] %s is now %s."),
+            *TargetActor->GetName(), bCanBeTargeted ? TEXT("targetable") : TEXT("untargetable"));
+    }
+}
+
+void UMCS_TargetingSubsystem::AddTargetToPool(AActor* TargetActor, float Distance, int32 TeamMask)
+{
+    const int32 Slot = FreeTargetSlots.Num() > 0 ? FreeTargetSlots.Pop(EAllowShrinking::No) : TargetSnapshot.Num();
+    TargetSnapshot.EnsureSlotCapacity(Slot + 1);
+    SlotKeys.SetNum(TargetSnapshot.Num());
+
+    const TObjectKey<AActor> Key(TargetActor);
+    SlotKeys[Slot] = Key;
+    TargetSnapshot.SlotByActor.Add(Key, Slot);
+    TargetSnapshot.Actors[Slot] = TargetActor;
+    TargetSnapshot.Occupied[Slot] = true;
+    TargetSnapshot.TeamMasks[Slot] = TeamMask;
+    TargetSnapshot.SlotGenerations[Slot] = FMath::Max(TargetSnapshot.SlotGenerations[Slot] + 1, 1u); // 0 = empty in the pose history
+    WriteSnapshotSlot(Slot, TargetActor);
+
+    FMCS_TargetInfo NewTarget;
+    NewTarget.TargetActor = TargetActor;
+    NewTarget.DistanceFromPlayer = Distance;
+    NewTarget.TargetSlot = Slot;
+    NewTarget.TeamMask = TeamMask;
+    NewTarget.EnteredTime = GetWorldTimeSeconds();
+    NewTarget.bIsValid = true;
+    RegisteredTargets.Add(NewTarget);
+}
+
+float UMCS_TargetingSubsystem::GetWorldTimeSeconds() const
+{
+    const UWorld* World = CachedWorld.Get();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void UMCS_TargetingSubsystem::ReleaseTargetSlot(const FMCS_TargetInfo& Info)
+{
+    const int32 Slot = Info.TargetSlot;
+    if (!TargetSnapshot.IsSlotValid(Slot))
+        return;
+
+    TargetSnapshot.SlotByActor.Remove(SlotKeys[Slot]);
+    TargetSnapshot.Actors[Slot].Reset();
+    TargetSnapshot.Occupied[Slot] = false;
+    SlotKeys[Slot] = TObjectKey<AActor>();
+    FreeTargetSlots.Add(Slot);
+
+    TargetSnapshot.Threats[Slot] = 0.0f;
+    TargetSnapshot.TeamMasks[Slot] = 0;
+
+    // The next occupant starts with unknown visibility and no engagement history, and is not ranked until a
+    // neighborhood rebuild accepts it (the slot may be reused within this maintenance cycle)
+    for (FMCS_TargetQuerier& Querier : Queriers)
+    {
+        Querier.ForgetSlot(Slot);
+
+        if (Querier.VisibilityCheckTimes.IsValidIndex(Slot))
+        {
+            Querier.VisibilityCheckTimes[Slot] = -1.0f;
+            Querier.OccludedSlots[Slot] = false;
+            Querier.EngagedTimes[Slot] = -1.0f;
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::WriteSnapshotSlot(int32 Slot, const AActor* TargetActor)
+{
+    // Dead actors keep their last known data until maintenance removes them
+    if (!IsValid(TargetActor))
+        return;
+
+    TargetSnapshot.Locations[Slot] = TargetActor->GetActorLocation();
+    TargetSnapshot.Velocities[Slot] = TargetActor->GetVelocity();
+    TargetSnapshot.Forwards[Slot] = TargetActor->GetActorForwardVector();
+    TargetActor->GetSimpleCollisionCylinder(TargetSnapshot.CapsuleRadii[Slot], TargetSnapshot.CapsuleHalfHeights[Slot]);
+}
+
+bool UMCS_TargetingSubsystem::GetRewoundTargetCapsule(const AActor* TargetActor, double Time, FVector& OutCenter, float& OutRadius, float& OutHalfHeight) const
+{
+    const int32 Slot = TargetSnapshot.FindSlot(TargetActor);
+    if (!TargetSnapshot.IsSlotValid(Slot))
+        return false;
+
+    // Radius is a per-character constant; only the center and half height (crouch) are recorded
+    OutRadius = TargetSnapshot.CapsuleRadii[Slot];
+    return PoseHistory.Sample(Slot, TargetSnapshot.SlotGenerations[Slot], Time, OutCenter, OutHalfHeight);
+}
+
+bool UMCS_TargetingSubsystem::ValidateRewoundHit(const AActor* TargetActor, double ViewTime, const FVector& BladeStart, const FVector& BladeEnd, float BladeRadius, float Tolerance) const
+{
+    const UWorld* World = CachedWorld.Get();
+    if (!World || !bRecordPoseHistory)
+        return false;
+
+    // Claims from too far back are rejected outright; future view times are clamped to now
+    const double Now = World->GetTimeSeconds();
+    if (Now - ViewTime > MaxRewindTime)
+        return false;
+
+    FVector Center;
+    float Radius, HalfHeight;
+    if (!GetRewoundTargetCapsule(TargetActor, FMath::Min(ViewTime, Now), Center, Radius, HalfHeight))
+        return false;
+
+    FMCS_CapsuleContact Contact;
+    const bool bHit = MCS_CombatMath::BladeVsUprightCapsule(BladeStart, BladeEnd, BladeRadius + FMath::Max(Tolerance, 0.0f), Center, Radius, HalfHeight, Contact);
+
+    if (bDebug)
+    {
+        DrawDebugCapsule(World, Center, HalfHeight, Radius, FQuat::Identity, bHit ? FColor::Green : FColor::Red, false, 2.0f);
+        DrawDebugLine(World, BladeStart, BladeEnd, FColor::Yellow, false, 2.0f, 0, 1.5f);
+    }
+
+    return bHit;
+}
+
+void UMCS_TargetingSubsystem::RefreshSnapshot()
+{
+    FMCS_TargetSnapshot& Snapshot = TargetSnapshot;
+    Snapshot.FrameNumber = GFrameCounter;
+
+    // Single pass over target actors; everything downstream reads the arrays
+    for (const FMCS_TargetInfo& Info : RegisteredTargets)
+    {
+        if (Snapshot.IsSlotValid(Info.TargetSlot))
+        {
+            WriteSnapshotSlot(Info.TargetSlot, Info.TargetActor);
+        }
+    }
+
+    const int32 NumQueriers = Queriers.Num();
+    const int32 NumSlots = Snapshot.Num();
+
+    Snapshot.QuerierActors.SetNum(NumQueriers);
+    Snapshot.QuerierLocations.SetNumUninitialized(NumQueriers);
+    Snapshot.QuerierForwards.SetNumUninitialized(NumQueriers);
+    Snapshot.Distances.SetNumUninitialized(NumQueriers * NumSlots);
+    Snapshot.Bearings.SetNumUninitialized(NumQueriers * NumSlots);
+
+    for (int32 QuerierIndex = 0; QuerierIndex < NumQueriers; ++QuerierIndex)
+    {
+        const AActor* Instigator = Queriers[QuerierIndex].Instigator.Get();
+        const bool bQuerierValid = IsValid(Instigator);
+
+        const FVector QuerierLocation = bQuerierValid ? Instigator->GetActorLocation() : FVector::ZeroVector;
+        const FVector QuerierForward = bQuerierValid ? Instigator->GetActorForwardVector() : FVector::ForwardVector;
+        const FVector QuerierRight(-QuerierForward.Y, QuerierForward.X, 0.0f);
+
+        Snapshot.QuerierActors[QuerierIndex] = Queriers[QuerierIndex].Instigator;
+        Snapshot.QuerierLocations[QuerierIndex] = QuerierLocation;
+        Snapshot.QuerierForwards[QuerierIndex] = QuerierForward;
+
+        float* Distances = Snapshot.Distances.GetData() + QuerierIndex * NumSlots;
+        float* Bearings = Snapshot.Bearings.GetData() + QuerierIndex * NumSlots;
+
+        for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+        {
+            if (!bQuerierValid || !Snapshot.Occupied[Slot])
+            {
+                Distances[Slot] = TNumericLimits<float>::Max();
+                Bearings[Slot] = 0.0f;
+                continue;
+            }
+
+            const FVector ToTarget = Snapshot.Locations[Slot] - QuerierLocation;
+            Distances[Slot] = ToTarget.Size();
+            Bearings[Slot] = FMath::RadiansToDegrees(FMath::Atan2(
+                FVector::DotProduct(QuerierRight, ToTarget),
+                FVector::DotProduct(QuerierForward, ToTarget)));
+        }
+    }
+
+    // DistanceFromPlayer is now live for every consumer
+    for (FMCS_TargetInfo& Info : RegisteredTargets)
+    {
+        if (!Snapshot.IsSlotValid(Info.TargetSlot))
+            continue;
+
+        float Nearest = TNumericLimits<float>::Max();
+        for (int32 QuerierIndex = 0; QuerierIndex < NumQueriers; ++QuerierIndex)
+        {
+            Nearest = FMath::Min(Nearest, Snapshot.GetDistance(QuerierIndex, Info.TargetSlot));
+        }
+        Info.DistanceFromPlayer = Nearest;
+    }
+
+    for (int32 QuerierIndex = 0; QuerierIndex < NumQueriers; ++QuerierIndex)
+    {
+        const FMCS_TargetQuerier& Querier = Queriers[QuerierIndex];
+        for (FMCS_TargetInfo& Info : Queriers[QuerierIndex].Neighborhood)
+        {
+            if (!Snapshot.IsSlotValid(Info.TargetSlot))
+                continue;
+
+            Info.DistanceFromPlayer = Snapshot.GetDistance(QuerierIndex, Info.TargetSlot);
+
+            // Cached visibility is free to read; unknown pairs stay visible
+            const bool bHasResult = bEnableLineOfSight && Querier.VisibilityCheckTimes.IsValidIndex(Info.TargetSlot);
+            Info.LastVisibilityCheckTime = bHasResult ? Querier.VisibilityCheckTimes[Info.TargetSlot] : -1.0f;
+            Info.bHasLineOfSight = !bHasResult || !Querier.OccludedSlots[Info.TargetSlot];
+        }
+    }
+}
+
+void UMCS_TargetingSubsystem::EnsureQuerierSlotCapacity(FMCS_TargetQuerier& Querier) const
+{
+    const int32 NumSlots = TargetSnapshot.Num();
+    const int32 OldNum = Querier.VisibilityCheckTimes.Num();
+    if (OldNum >= NumSlots)
+        return;
+
+    Querier.OccludedSlots.SetNum(NumSlots, false);
+    Querier.SlotScores.SetNumZeroed(NumSlots);
+    Querier.SlotViewBearings.SetNumZeroed(NumSlots);
+    Querier.SlotBearingOrder.SetNumZeroed(NumSlots);
+
+    Querier.VisibilityCheckTimes.SetNumUninitialized(NumSlots);
+    Querier.EngagedTimes.SetNumUninitialized(NumSlots);
+    for (int32 Slot = OldNum; Slot < NumSlots; ++Slot)
+    {
+        Querier.VisibilityCheckTimes[Slot] = -1.0f;
+        Querier.EngagedTimes[Slot] = -1.0f;
+    }
+}
+
+/* ==========================================================
+ * Target Ranking
+ * ========================================================== */
+
+namespace MCS_TargetRanking
+{
+    /** Insertion sort: O(n) when the order barely changed since last frame, which is the common case */
+    template <typename PredicateType>
+    void InsertionSort(TArray<int32>& Items, PredicateType Less)
+    {
+        for (int32 Index = 1; Index < Items.Num(); ++Index)
+        {
+            const int32 Item = Items[Index];
+            int32 Hole = Index;
+            while (Hole > 0 && Less(Item, Items[Hole - 1]))
+            {
+                Items[Hole] = Items[Hole - 1];
+                --Hole;
+            }
+            Items[Hole] = Item;
+        }
+    }
+}
+
+bool UMCS_TargetingSubsystem::IsSlotOwnedBy(int32 Slot, const AActor* Actor) const
+{
+    return Actor && TargetSnapshot.IsSlotValid(Slot) && TargetSnapshot.Actors[Slot].Get() == Actor;
+}
+
+FMCS_TargetQuerier* UMCS_TargetingSubsystem::FindQuerierMutable(const AActor* Instigator)
+{
+    if (!Instigator)
+        return nullptr;
+
+    return Queriers.FindByPredicate([ Instigator ] (const FMCS_TargetQuerier& Querier)
+        {
+            return Querier.Instigator.Get() == Instigator;
+        });
+}
+
+void UMCS_TargetingSubsystem::UpdateRankings()
+{
+    const FMCS_TargetRankingWeights& Weights = RankingWeights;
+    const float Now = GetWorldTimeSeconds();
+    const float InvExitRadius = 1.0f / FMath::Max(GetExitRadius(), 1.0f);
+    TBitArray<> Members;
+
+    for (int32 QuerierIndex = 0; QuerierIndex < Queriers.Num(); ++QuerierIndex)
+    {
+        FMCS_TargetQuerier& Querier = Queriers[QuerierIndex];
+        const AActor* Instigator = Querier.Instigator.Get();
+        if (!IsValid(Instigator) || !TargetSnapshot.QuerierLocations.IsValidIndex(QuerierIndex))
+            continue;
+
+        EnsureQuerierSlotCapacity(Querier);
+
+        // Slots can be released between neighborhood rebuilds
+        for (const int32 Slot : Querier.RankedSlots)
+        {
+            if (!TargetSnapshot.IsSlotValid(Slot))
+            {
+                Querier.bRankingDirty = true;
+                break;
+            }
+        }
+
+        // Low combat LOD: scores refresh at the querier's own rate, but membership changes are never delayed
+        const bool bMembershipChanged = Querier.bRankingDirty;
+        if (!bMembershipChanged && Now < Querier.NextRankingTime)
+            continue;
+        Querier.NextRankingTime = Now + Querier.RankingRefreshInterval;
+
+        // Membership changed: drop leavers and append newcomers, keeping the previous order as a warm start
+        if (bMembershipChanged)
+        {
+            Members.Init(false, TargetSnapshot.Num());
+            for (const FMCS_TargetInfo& Info : Querier.Neighborhood)
+            {
+                if (IsSlotOwnedBy(Info.TargetSlot, Info.TargetActor))
+                {
+                    Members[Info.TargetSlot] = true;
+                }
+            }
+
+            auto IsLeaver = [ &Members ] (int32 Slot) { return !Members.IsValidIndex(Slot) || !Members[Slot]; };
+            Querier.RankedSlots.RemoveAll(IsLeaver);
+            Querier.BearingSortedSlots.RemoveAll(IsLeaver);
+
+            for (const int32 Slot : Querier.RankedSlots)
+            {
+                Members[Slot] = false;
+            }
+            for (TConstSetBitIterator<> It(Members); It; ++It)
+            {
+                Querier.RankedSlots.Add(It.GetIndex());
+                Querier.BearingSortedSlots.Add(It.GetIndex());
+            }
+            Querier.bRankingDirty = false;
+
+            // A lock only survives while its target is still in the neighborhood
+            const int32 LockedSlot = TargetSnapshot.FindSlot(Querier.LockedTarget.Get());
+            if (LockedSlot == INDEX_NONE || !Querier.RankedSlots.Contains(LockedSlot))
+            {
+                Querier.LockedTarget.Reset();
+            }
+        }
+
+        // View direction: camera/control rotation for controlled pawns, actor forward otherwise
+        FVector EyeLocation;
+        FRotator ViewRotation = Instigator->GetActorRotation();
+        if (Weights.bUseViewRotation)
+        {
+            Instigator->GetActorEyesViewPoint(EyeLocation, ViewRotation);
+        }
+        const float ViewYaw = ViewRotation.Yaw;
+        const FVector QuerierLocation = TargetSnapshot.QuerierLocations[QuerierIndex];
+
+        for (const int32 Slot : Querier.RankedSlots)
+        {
+            const FVector ToTarget = TargetSnapshot.Locations[Slot] - QuerierLocation;
+            const float Bearing = FRotator::NormalizeAxis(FMath::RadiansToDegrees(FMath::Atan2(ToTarget.Y, ToTarget.X)) - ViewYaw);
+
+            const float DistanceTerm = 1.0f - FMath::Clamp(TargetSnapshot.GetDistance(QuerierIndex, Slot) * InvExitRadius, 0.0f, 1.0f);
+            const float AngleTerm = 1.0f - FMath::Abs(Bearing) / 180.0f;
+            const float ThreatTerm = TargetSnapshot.Threats[Slot];
+            const float EngagedTime = Querier.EngagedTimes[Slot];
+            const float RecencyTerm = EngagedTime >= 0.0f ? FMath::Pow(0.5f, (Now - EngagedTime) / FMath::Max(Weights.RecencyHalfLife, KINDA_SMALL_NUMBER)) : 0.0f;
+
+            Querier.SlotViewBearings[Slot] = Bearing;
+            Querier.SlotScores[Slot] =
+                Weights.DistanceWeight * DistanceTerm +
+                Weights.AngleWeight * AngleTerm +
+                Weights.ThreatWeight * ThreatTerm +
+                Weights.RecencyWeight * RecencyTerm;
+        }
+
+        const TArray<float>& Scores = Querier.SlotScores;
+        const TArray<float>& Bearings = Querier.SlotViewBearings;
+        MCS_TargetRanking::InsertionSort(Querier.RankedSlots, [ &Scores ] (int32 A, int32 B) { return Scores[A] > Scores[B]; });
+        MCS_TargetRanking::InsertionSort(Querier.BearingSortedSlots, [ &Bearings ] (int32 A, int32 B) { return Bearings[A] < Bearings[B]; });
+
+        for (int32 Order = 0; Order < Querier.BearingSortedSlots.Num(); ++Order)
+        {
+            Querier.SlotBearingOrder[Querier.BearingSortedSlots[Order]] = Order;
+        }
+    }
+}
+
+AActor* UMCS_TargetingSubsystem::GetBestTarget(AActor* Instigator) const
+{
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    if (!Querier || Querier->RankedSlots.IsEmpty())
+        return nullptr;
+
+    return TargetSnapshot.Actors[Querier->RankedSlots[0]].Get();
+}
+
+void UMCS_TargetingSubsystem::GetTopTargets(AActor* Instigator, int32 Count, TArray<AActor*>& OutTargets) const
+{
+    OutTargets.Reset();
+
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    if (!Querier)
+        return;
+
+    const int32 NumResults = FMath::Clamp(Count, 0, Querier->RankedSlots.Num());
+    OutTargets.Reserve(NumResults);
+    for (int32 Rank = 0; Rank < NumResults; ++Rank)
+    {
+        if (AActor* Target = TargetSnapshot.Actors[Querier->RankedSlots[Rank]].Get())
+        {
+            OutTargets.Add(Target);
+        }
+    }
+}
+
+AActor* UMCS_TargetingSubsystem::CycleTarget(AActor* Instigator, EMCS_TargetCycleDirection Direction)
+{
+    FMCS_TargetQuerier* Querier = FindQuerierMutable(Instigator);
+    if (!Querier || Querier->BearingSortedSlots.IsEmpty())
+        return nullptr;
+
+    // No lock yet: start from the best target
+    const int32 LockedSlot = TargetSnapshot.FindSlot(Querier->LockedTarget.Get());
+    if (!Querier->RankedSlots.IsEmpty() && (LockedSlot == INDEX_NONE || !Querier->SlotBearingOrder.IsValidIndex(LockedSlot)))
+    {
+        SetLockedTarget(Instigator, TargetSnapshot.Actors[Querier->RankedSlots[0]].Get());
+        return Querier->LockedTarget.Get();
+    }
+
+    // Neighbor in bearing order; stays put at the edge of the view
+    const int32 Order = Querier->SlotBearingOrder[LockedSlot] + (Direction == EMCS_TargetCycleDirection::Right ? 1 : -1);
+    if (Querier->BearingSortedSlots.IsValidIndex(Order))
+    {
+        SetLockedTarget(Instigator, TargetSnapshot.Actors[Querier->BearingSortedSlots[Order]].Get());
+    }
+
+    return Querier->LockedTarget.Get();
+}
+
+void UMCS_TargetingSubsystem::SetLockedTarget(AActor* Instigator, AActor* Target)
+{
+    FMCS_TargetQuerier* Querier = FindQuerierMutable(Instigator);
+    if (!Querier)
+        return;
+
+    // Only targets the instigator currently ranks can be locked
+    const int32 Slot = TargetSnapshot.FindSlot(Target);
+    if (!Target || !Querier->RankedSlots.Contains(Slot))
+    {
+        Querier->LockedTarget.Reset();
+        return;
+    }
+
+    Querier->LockedTarget = Target;
+    NotifyTargetEngaged(Instigator, Target);
+}
+
+AActor* UMCS_TargetingSubsystem::GetLockedTarget(AActor* Instigator) const
+{
+    const FMCS_TargetQuerier* Querier = FindQuerier(Instigator);
+    return Querier ? Querier->LockedTarget.Get() : nullptr;
+}
+
+void UMCS_TargetingSubsystem::SetTargetThreat(AActor* TargetActor, float Threat)
+{
+    const int32 Slot = TargetSnapshot.FindSlot(TargetActor);
+    if (TargetSnapshot.IsSlotValid(Slot))
+    {
+        TargetSnapshot.Threats[Slot] = FMath::Clamp(Threat, 0.0f, 1.0f);
+    }
+}
+
+void UMCS_TargetingSubsystem::NotifyTargetEngaged(AActor* Instigator, AActor* TargetActor)
+{
+    FMCS_TargetQuerier* Querier = FindQuerierMutable(Instigator);
+    const int32 Slot = TargetSnapshot.FindSlot(TargetActor);
+    if (!Querier || !TargetSnapshot.IsSlotValid(Slot))
+        return;
+
+    EnsureQuerierSlotCapacity(*Querier);
+    Querier->EngagedTimes[Slot] = GetWorldTimeSeconds();
+}
+
+void UMCS_TargetingSubsystem::CollectVisibilityTraces()
+{
+    UWorld* World = CachedWorld.Get();
+    if (!World) return;
+
+    const float Now = GetWorldTimeSeconds();
+    FTraceDatum Datum;
+
+    for (const FMCS_PendingVisibilityTrace& Pending : PendingVisibilityTraces)
+    {
+        if (!World->QueryTraceData(Pending.Handle, Datum))
+            continue;
+
+        // The slot may have been released or reused while the trace was in flight
+        if (!TargetSnapshot.IsSlotValid(Pending.TargetSlot) || TargetSnapshot.Actors[Pending.TargetSlot] != Pending.Target)
+            continue;
+
+        for (FMCS_TargetQuerier& Querier : Queriers)
+        {
+            if (Querier.Instigator != Pending.Instigator)
+                continue;
+
+            // Instigator and target are ignored by the trace, so any blocking hit is an occluder
+            const bool bBlocked = Datum.OutHits.ContainsByPredicate([ ] (const FHitResult& Hit) { return Hit.bBlockingHit; });
+
+            EnsureQuerierSlotCapacity(Querier);
+            Querier.OccludedSlots[Pending.TargetSlot] = bBlocked;
+            Querier.VisibilityCheckTimes[Pending.TargetSlot] = Now;
+
+            if (bDebug)
+            {
+                DrawDebugLine(World, Datum.Start, Datum.End, bBlocked ? FColor::Red : FColor::Green, false, LineOfSightRefreshInterval);
+            }
+            break;
+        }
+    }
+
+    PendingVisibilityTraces.Reset();
+}
+
+void UMCS_TargetingSubsystem::DispatchVisibilityTraces()
+{
+    UWorld* World = CachedWorld.Get();
+    if (!World || Queriers.IsEmpty())
+        return;
+
+    int32 TotalEntries = 0;
+    for (const FMCS_TargetQuerier& Querier : Queriers)
+    {
+        TotalEntries += Querier.Neighborhood.Num();
+    }
+
+    const float Now = GetWorldTimeSeconds();
+    int32 TracesIssued = 0;
+
+    // Visit every pair at most once per frame, resuming from last frame's cursor
+    for (int32 Visited = 0; Visited < TotalEntries && TracesIssued < MaxLineOfSightTracesPerFrame; )
+    {
+        if (!Queriers.IsValidIndex(VisibilityQuerierCursor))
+        {
+            VisibilityQuerierCursor = 0;
+            VisibilityEntryCursor = 0;
+        }
+
+        FMCS_TargetQuerier& Querier = Queriers[VisibilityQuerierCursor];
+        if (VisibilityEntryCursor >= Querier.Neighborhood.Num())
+        {
+            ++VisibilityQuerierCursor;
+            VisibilityEntryCursor = 0;
+            continue;
+        }
+
+        const FMCS_TargetInfo& Info = Querier.Neighborhood[VisibilityEntryCursor++];
+        ++Visited;
+
+        AActor* Instigator = Querier.Instigator.Get();
+        if (!IsValid(Instigator) || !IsValid(Info.TargetActor) || !TargetSnapshot.IsSlotValid(Info.TargetSlot))
+            continue;
+
+        // Cached result is still fresh
+        EnsureQuerierSlotCapacity(Querier);
+        const float LastCheck = Querier.VisibilityCheckTimes[Info.TargetSlot];
+        if (LastCheck >= 0.0f && Now - LastCheck < LineOfSightRefreshInterval)
+            continue;
+
+        FVector EyeLocation;
+        FRotator EyeRotation;
+        Instigator->GetActorEyesViewPoint(EyeLocation, EyeRotation);
+
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(MCS_TargetLineOfSight), false, Instigator);
+        Params.AddIgnoredActor(Info.TargetActor);
+
+        FMCS_PendingVisibilityTrace& Pending = PendingVisibilityTraces.AddDefaulted_GetRef();
+        Pending.Handle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, EyeLocation, TargetSnapshot.Locations[Info.TargetSlot], LineOfSightChannel, Params);
+        Pending.Instigator = Instigator;
+        Pending.Target = Info.TargetActor;
+        Pending.TargetSlot = Info.TargetSlot;
+        ++TracesIssued;
+    }
+}
+
+void UMCS_TargetingSubsystem::SetTargetScanningEnabled(bool bEnable)
+{
+    if (!IsValid(CachedWorld))
+    {
+        if (bDebug)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[MCS_TargetingSubsystem] Cannot toggle scanning — no valid world."));
+        }
+        return;
+    }
+
+    if (bIsScanningEnabled == bEnable)
+    {
+        // No change
+        return;
+    }
+
+    bIsScanningEnabled = bEnable;
 
     if (bIsScanningEnabled)
     {
-        // Start (or resume) scanning
-        TimerMgr.SetTimer(
-            ScanTimerHandle,
-            this,
-            &UMCS_TargetingSubsystem::ScanForTargets,
-            TargetScanInterval,
-            true);
+        // Start (or resume) scanning; Tick picks up from here
+        TimeSinceLastScan = FMath::Max(TargetScanInterval, MaxTargetScanInterval);
 
         UE_LOG(LogTemp, Log, TEXT("[MCS_TargetingSubsystem] Target scanning ENABLED."));
     }
     else
     {
-        // Stop scanning and clear targets (optional)
-        TimerMgr.ClearTimer(ScanTimerHandle);
+        // Stop scanning and drop any half-finished cycle
+        MaintenancePhase = EMCS_TargetMaintenancePhase::Idle;
+        PendingCandidates.Reset();
 
         if (bDebug)
         {
@@ -0,0 +1,68 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxWindowTests.cpp
+ * Automation tests for the per-window hit bookkeeping of the hitbox component.
+ */
+
+#include "Misc/AutomationTest.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+#include <Components/MCS_CombatHitboxComponent.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCS_HitboxWindowRegisteredMidSwingTest, "MotionCombatSystem.Hitbox.TargetRegisteredMidSwing",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMCS_HitboxWindowRegisteredMidSwingTest::RunTest(const FString& Parameters)
+{
+    AActor* Target = NewObject<AActor>(GetTransientPackage());
+
+    // Hit while not a registered target: it goes to the overflow list
+    FMCS_ActiveHitboxWindow Window;
+    TestFalse(TEXT("Fresh window has no hits"), Window.WasHit(Target, INDEX_NONE, 0));
+    Window.MarkHit(Target, INDEX_NONE, 0);
+
+    // Registered later in the same swing (slot 2, first occupant): still counts as hit
+    TestTrue(TEXT("Actor hit before registration is not hit again"), Window.WasHit(Target, 2, 1));
+
+    Window.ResetHits();
+    TestFalse(TEXT("Next swing starts clean"), Window.WasHit(Target, 2, 1));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCS_HitboxWindowSlotReuseTest, "MotionCombatSystem.Hitbox.SlotReusedMidSwing",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMCS_HitboxWindowSlotReuseTest::RunTest(const FString& Parameters)
+{
+    AActor* FirstOccupant = NewObject<AActor>(GetTransientPackage());
+    AActor* NewOccupant = NewObject<AActor>(GetTransientPackage());
+
+    // The first occupant of slot 3 (generation 4) is hit
+    FMCS_ActiveHitboxWindow Window;
+    Window.MarkHit(FirstOccupant, 3, 4);
+    TestTrue(TEXT("Hit occupant is deduplicated"), Window.WasHit(FirstOccupant, 3, 4));
+
+    // It is unregistered and slot 3 goes to a new actor (generation 5) before the swing ends
+    TestFalse(TEXT("New occupant of a reused slot can still be hit"), Window.WasHit(NewOccupant, 3, 5));
+
+    Window.MarkHit(NewOccupant, 3, 5);
+    TestTrue(TEXT("New occupant is deduplicated once hit"), Window.WasHit(NewOccupant, 3, 5));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
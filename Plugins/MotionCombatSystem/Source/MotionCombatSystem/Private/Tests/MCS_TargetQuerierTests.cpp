@@ -0,0 +1,58 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_TargetQuerierTests.cpp
+ * Automation tests for the per-querier targeting bookkeeping.
+ */
+
+#include "Misc/AutomationTest.h"
+#include <Structs/MCS_TargetQuerier.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCS_TargetQuerierSlotReuseTest, "MotionCombatSystem.Targeting.SlotReuseWithinCycle",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FMCS_TargetQuerierSlotReuseTest::RunTest(const FString& Parameters)
+{
+    // A ranked querier: slot 3 is the best target, slot 1 sits left of it in bearing order
+    FMCS_TargetQuerier Querier;
+    Querier.Neighborhood.AddDefaulted_GetRef().TargetSlot = 1;
+    Querier.Neighborhood.AddDefaulted_GetRef().TargetSlot = 3;
+    Querier.RankedSlots = { 3, 1 };
+    Querier.BearingSortedSlots = { 1, 3 };
+    Querier.SlotBearingOrder.Init(INDEX_NONE, 4);
+    Querier.SlotBearingOrder[1] = 0;
+    Querier.SlotBearingOrder[3] = 1;
+    Querier.bRankingDirty = false;
+
+    // Slot 3 is released by the refresh pass; the filter pass then hands it to a new actor before Commit.
+    // The new occupant is not in this querier's neighborhood, so slot 3 must not be ranked any more.
+    Querier.ForgetSlot(3);
+
+    TestEqual(TEXT("Released slot leaves the ranking"), Querier.RankedSlots, TArray<int32>({ 1 }));
+    TestEqual(TEXT("Released slot leaves the bearing order"), Querier.BearingSortedSlots, TArray<int32>({ 1 }));
+    TestEqual(TEXT("Remaining bearing order is intact"), Querier.SlotBearingOrder[1], 0);
+    TestFalse(TEXT("Released slot leaves the neighborhood"), Querier.Neighborhood.ContainsByPredicate([ ] (const FMCS_TargetInfo& Info) { return Info.TargetSlot == 3; }));
+    TestTrue(TEXT("Ranking is rebuilt on the next update"), Querier.bRankingDirty);
+
+    // Releasing a slot the querier never ranked leaves it untouched
+    Querier.bRankingDirty = false;
+    Querier.ForgetSlot(2);
+    TestEqual(TEXT("Unrelated release keeps the ranking"), Querier.RankedSlots, TArray<int32>({ 1 }));
+    TestFalse(TEXT("Unrelated release does not dirty the ranking"), Querier.bRankingDirty);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
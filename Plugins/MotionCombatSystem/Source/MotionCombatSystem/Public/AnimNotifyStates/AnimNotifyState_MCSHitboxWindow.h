@@ -90,4 +90,15 @@ public:
         if (!MeshComp) return;
         OnNotifyEnd.Broadcast(Hitbox); // Broadcast the end event
     }
+
+#if WITH_EDITOR
+    // Re-bakes the hitbox trajectory whenever the owning montage is saved or cooked
+    virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+    /**
+     * Samples the start/end sockets over this window of the owning montage into Hitbox's baked trajectory
+     * (component space, fixed rate). Clears the bake when bBakeTrajectory is off or the sockets cannot be resolved.
+     */
+    void BakeTrajectory();
+#endif
 };
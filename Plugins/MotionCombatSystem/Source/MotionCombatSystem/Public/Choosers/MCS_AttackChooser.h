@@ -32,6 +32,55 @@
 #include "MCS_AttackChooser.generated.h"
 
 class AActor;
+struct FMCS_TargetSnapshot;
+
+/**
+ * Target data resolved once per ChooseAttack call and shared by every entry's scoring pass.
+ * Entry-independent results (closest distance, basic filter pass) are computed up front.
+ */
+struct FMCS_ChooserTargetCache
+{
+    const AActor* Instigator = nullptr;
+    const TArray<AActor*>* Targets = nullptr;
+
+    FVector InstigatorLocation = FVector::ZeroVector;
+    FVector InstigatorForward = FVector::ForwardVector;
+
+    /** Locations of the valid targets, in Targets order */
+    TArray<FVector> TargetLocations;
+
+    /** Valid targets' position relative to the instigator and velocity, split per axis for the prediction loop */
+    TArray<float> RelativeX, RelativeY, RelativeZ;
+    TArray<float> VelocityX, VelocityY, VelocityZ;
+
+    /** Closest predicted distance per lookahead time already evaluated this call (X = time, Y = distance) */
+    mutable TArray<FVector2f> LookaheadMemo;
+
+    /** Squared distance to the closest valid target (FLT_MAX when none) */
+    float ClosestDistSq = TNumericLimits<float>::Max();
+
+    /** Result of the distance/angle filter, which does not depend on the entry */
+    bool bPassesBasicFilters = true;
+
+    bool IsBuiltFor(const AActor* InInstigator, const TArray<AActor*>& InTargets) const
+    {
+        return Instigator && Instigator == InInstigator && Targets == &InTargets;
+    }
+
+    void Reset()
+    {
+        Instigator = nullptr;
+        Targets = nullptr;
+        TargetLocations.Reset();
+        RelativeX.Reset();
+        RelativeY.Reset();
+        RelativeZ.Reset();
+        VelocityX.Reset();
+        VelocityY.Reset();
+        VelocityZ.Reset();
+        LookaheadMemo.Reset();
+    }
+};
 
 /**
  * UMCS_AttackChooser
@@ -69,6 +118,24 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
     bool bRandomTieBreak;
 
+    /**
+     * Optional per-frame target snapshot (set by the combat core around ChooseAttack).
+     * When present, target positions are read from it instead of from each actor.
+     */
+    const FMCS_TargetSnapshot* TargetSnapshot = nullptr;
+
+    /** Score distance against where targets will be at impact (current velocity times the attack's hit lookahead). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
+    bool bPredictTargetMotion = true;
+
+    /** Upper bound for the hit lookahead used in target prediction (seconds). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser", meta = (EditCondition = "bPredictTargetMotion", ClampMin = "0.0"))
+    float MaxPredictionTime = 1.0f;
+
+    /** Only consider targets the instigator can see (requires line of sight on the targeting subsystem). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
+    bool bRequireLineOfSight = false;
+
     /** Optional tag filtering for attack selection. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|AttackChooser")
     FGameplayTag RequiredAttackTag;
@@ -117,6 +184,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Compute Distance Score", ReturnDisplayName = "Score"))
     float ComputeDistanceScore(const FMCS_AttackEntry& Entry, AActor* Instigator, const TArray<AActor*>& Targets) const;
 
+    /**
+     * Seconds from the start of an attack to its first hit window (HitLookaheadOverride if set), clamped to
+     * MaxPredictionTime. Cached per montage/section.
+     */
+    UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Get Hit Lookahead Time", ReturnDisplayName = "Seconds"))
+    float GetHitLookaheadTime(const FMCS_AttackEntry& Entry) const;
+
     /** Computes a score modifier based on desired attack direction. */
     UFUNCTION(BlueprintPure, Category = "MCS|AttackChooser|Scoring", meta = (DisplayName = "Compute Directional Score", ReturnDisplayName = "Score"))
     float ComputeDirectionalScore(const FMCS_AttackEntry& Entry, EMCS_AttackDirection DesiredDirection) const;
@@ -155,4 +229,26 @@ protected:
 
     /** Queries a specific attribute value from the current situation. */
     float QueryAttributeValue(FName Attribute, const FMCS_AttackSituation& Situation) const;
+
+private:
+    /** Target data for the ChooseAttack call in progress */
+    mutable FMCS_ChooserTargetCache TargetCache;
+
+    /** First hit window time per montage and section */
+    mutable TMap<TPair<TObjectKey<UAnimMontage>, FName>, float> HitLookaheadCache;
+
+    /** Resolves an actor's location, preferring the target snapshot */
+    FVector ResolveTargetLocation(const AActor* Actor) const;
+
+    /** Resolves an actor's velocity, preferring the target snapshot */
+    FVector ResolveTargetVelocity(const AActor* Actor) const;
+
+    /** Closest predicted target distance after LookaheadTime seconds (memoized per time within a call) */
+    static float GetPredictedClosestDistance(const FMCS_ChooserTargetCache& Cache, float LookaheadTime);
+
+    /** Fills a target cache for the given instigator and targets */
+    void BuildTargetCache(const AActor* Instigator, const TArray<AActor*>& Targets, FMCS_ChooserTargetCache& OutCache) const;
+
+    /** Returns the active cache if it matches, otherwise builds one into Scratch */
+    const FMCS_ChooserTargetCache& GetTargetCache(const AActor* Instigator, const TArray<AActor*>& Targets, FMCS_ChooserTargetCache& Scratch) const;
 };
@@ -32,6 +32,8 @@
 #include <AnimNotifyStates/AnimNotifyState_MCSHitboxWindow.h>
 #include <AnimNotifyStates/AnimNotifyState_MCSComboWindow.h>
 #include <Components/MCS_CombatHitboxComponent.h>
+#include <Enums/EMCS_CombatLOD.h>
+#include <Structs/MCS_CombatLODSettings.h>
 #include "MCS_CombatCoreComponent.generated.h"
 
 
@@ -73,7 +75,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Core", meta = (DisplayName = "Player Situation"))
     FMCS_AttackSituation PlayerSituation;
 
-    /** Blueprint Event triggered whenever the TargetingSubsystem's target list is updated */
+    /** Teams this combatant may target (0 = any team). Applied when registering with the targeting subsystem. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Core|Teams", meta = (Bitmask))
+    int32 TargetIncludeTeamMask = 0;
+
+    /** Teams this combatant never targets or hits */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Core|Teams", meta = (Bitmask))
+    int32 TargetExcludeTeamMask = 0;
+
+    /** Also exclude the owner's own team (GetCombatTeamMask, or the latest SetTargetTeamMask push for the owner) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Core|Teams")
+    bool bExcludeOwnTeam = true;
+
+    /** Blueprint Event triggered whenever targets enter or leave this combatant's own neighborhood */
     UPROPERTY(BlueprintAssignable, Category = "MCS|Core|Events", meta = (DisplayName = "On Targeting Updated"))
     FOnTargetingUpdatedSignature OnTargetingUpdated;
 
@@ -112,6 +126,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Get Closest Target"))
     AActor* GetClosestTarget(float MaxRange = 2500.f) const;
 
+    /** Gets the highest-ranked target for this combatant via TargetingSubsystem (no rescan) */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Get Best Target"))
+    AActor* GetBestTarget() const;
+
+    /** Changes which teams this combatant targets and pushes the filter to the targeting subsystem */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core|Teams", meta = (DisplayName = "Set Target Team Filter"))
+    void SetTargetTeamFilter(int32 IncludeTeamMask, int32 ExcludeTeamMask);
+
+    /** Switches the lock-on target to the left or right (locks the best target if none is locked) */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Cycle Lock-On Target"))
+    AActor* CycleLockOnTarget(EMCS_TargetCycleDirection Direction);
+
     /**
      * Utility to convert 2D movement input into an EMCS_AttackDirection enum value
      * @param MoveInput - 2D movement input vector (X=Forward/Backward, Y=Left/Right)
@@ -139,6 +165,24 @@ public:
     UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Get Current Attack"))
     FMCS_AttackEntry GetCurrentAttack() const { return CurrentAttack; }
 
+    /**
+     * Applies a combat LOD tier: chooser scoring, targeting refresh rate and the hitbox's substeps/tick interval.
+     * Called by UMCS_CombatSignificanceSubsystem; can also be called manually to pin a combatant's fidelity.
+     */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Core|LOD", meta = (DisplayName = "Apply Combat LOD"))
+    void ApplyCombatLOD(EMCS_CombatLOD NewLOD, const FMCS_CombatLODSettings& Settings);
+
+    /** Current combat LOD tier */
+    UFUNCTION(BlueprintPure, Category = "MCS|Core|LOD", meta = (DisplayName = "Get Combat LOD"))
+    EMCS_CombatLOD GetCombatLOD() const { return CombatLOD; }
+
+    /** Whether the current attack's montage is playing on the owner */
+    UFUNCTION(BlueprintPure, Category = "MCS|Core", meta = (DisplayName = "Is Attacking"))
+    bool IsAttacking() const;
+
+    /** Called by the targeting subsystem when this combatant's own neighborhood gained or lost targets */
+    void HandleNeighborhoodChanged();
+
     UFUNCTION(BlueprintCallable, Category = "MCS|Core", meta = (DisplayName = "Update Player Situation"))
     void UpdatePlayerSituation(float DeltaTime);
 
@@ -156,6 +200,9 @@ public:
 protected:
     virtual void BeginPlay() override;
 
+    /** Leaves the targeting subsystem's querier list */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /** Update PlayerSituation each frame */
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -184,6 +231,19 @@ private:
     UPROPERTY()
     FGameplayTag ActiveAttackSetTag;
 
+    /** Current combat LOD tier and its settings */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Core|LOD", meta = (AllowPrivateAccess = "true"))
+    EMCS_CombatLOD CombatLOD = EMCS_CombatLOD::High;
+
+    FMCS_CombatLODSettings CombatLODSettings;
+
+    /** Last chooser pick, reused by SelectAttack for the same request when the LOD tier skips full scoring */
+    FMCS_AttackEntry CachedPick;
+    FGameplayTag CachedPickSetTag;
+    EMCS_AttackType CachedPickType = EMCS_AttackType::Light;
+    EMCS_AttackDirection CachedPickDirection = EMCS_AttackDirection::Forward;
+    bool bHasCachedPick = false;
+
     /** Cached list of hitbox window data parsed from the current montage */
     TArray<FMCS_AttackHitbox> CachedHitboxWindows;
 
@@ -214,10 +274,6 @@ private:
      * Functions
      */
 
-    // Handler for TargetingSubsystem target updates
-    UFUNCTION()
-    void HandleTargetsUpdated(const TArray<FMCS_TargetInfo>& NewTargets, int32 NewTargetCount);
-
     // Subscribe/unsubscribe to all hitbox notifies used by a montage
     void BindNotifiesForMontage(UAnimMontage* Montage);
     void UnbindAllNotifies();
@@ -20,10 +20,20 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Containers/StaticArray.h"
 #include <Structs/MCS_AttackEntry.h>
 #include <Structs/MCS_AttackHitbox.h>
+#include <Structs/MCS_CombatLODSettings.h>
+#include <Structs/MCS_HitboxSweepRequest.h>
+#include <Structs/MCS_HitEvent.h>
+#include <Debug/MCS_HitboxDebugBatch.h>
 #include "MCS_CombatHitboxComponent.generated.h"
 
+class UMCS_TargetingSubsystem;
+class UMCS_HitboxSweepSubsystem;
+class USkeletalMeshComponent;
+class USkinnedAsset;
+
 
 /*
  * Delegates
@@ -33,9 +43,106 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMCS_OnSimpleHitSignature, AActor*, HitActor, const FHitResult&, HitResult, FMCS_AttackEntry, AttackEntry);
 
 
+/**
+ * A socket (or bone) name resolved to a bone index and the socket's offset in that bone's space,
+ * so sweeps read component-space bone transforms instead of looking sockets up by name.
+ */
+struct FMCS_ResolvedSocket
+{
+    int32 BoneIndex = INDEX_NONE;
+    FVector BoneOffset = FVector::ZeroVector;
+};
+
+/**
+ * One hitbox window in flight. Overlapping windows (dual wield, kick plus punch, weapon plus shockwave)
+ * each get their own slot, matched by socket pair, with their own previous-socket state and hit set.
+ */
+struct FMCS_ActiveHitboxWindow
+{
+    FMCS_AttackEntry Attack;
+    FMCS_AttackHitbox Hitbox;
+
+    /** Serial of the window occupying this slot; requests carry it so results for a replaced window are dropped */
+    uint32 Serial = 0;
+
+    /** Still sweeping. A stopped slot keeps its hit set until reused, so late async results still dedupe. */
+    bool bActive = false;
+
+    // Previous sweep's socket positions
+    FVector PrevStartLoc = FVector::ZeroVector;
+    FVector PrevEndLoc = FVector::ZeroVector;
+
+    // Baked trajectory: window time and mesh transform at the previous sweep
+    float PrevWindowTime = 0.0f;
+    FTransform PrevMeshTransform = FTransform::Identity;
+
+    // Fixed-timestep mode: last step swept (INDEX_NONE = none yet), and whether the window ended and is running its remaining steps
+    int32 LastFixedStep = INDEX_NONE;
+    bool bDrainFixedSteps = false;
+
+    // Prevent hitting same actor multiple times in one swing: registered targets by snapshot slot, storing the
+    // generation of the occupant that was hit (FMCS_TargetSnapshot::SlotGenerations, 0 = none), anything else in a
+    // short overflow list. A slot reused by a new actor mid-swing therefore does not inherit the old one's hit, and an
+    // actor hit before it was registered stays hit. Both keep their storage across windows.
+    TArray<uint32> HitSlotGenerations;
+    TArray<TWeakObjectPtr<AActor>, TInlineAllocator<8>> HitOverflow;
+
+    // Start/End sockets resolved against the cached mesh
+    FMCS_ResolvedSocket StartBone;
+    FMCS_ResolvedSocket EndBone;
+
+    bool UsesSockets(const FMCS_AttackHitbox& Other) const
+    {
+        return Hitbox.StartSocket == Other.StartSocket && Hitbox.EndSocket == Other.EndSocket;
+    }
+
+    void ResetHits()
+    {
+        FMemory::Memzero(HitSlotGenerations.GetData(), HitSlotGenerations.Num() * HitSlotGenerations.GetTypeSize());
+        HitOverflow.Reset();
+    }
+
+    /**
+     * Whether this window already hit the actor. TargetSlot/SlotGeneration are its snapshot slot and that slot's
+     * current generation, or INDEX_NONE/0 for actors that are not registered targets.
+     */
+    bool WasHit(const AActor* Actor, int32 TargetSlot, uint32 SlotGeneration) const
+    {
+        if (TargetSlot != INDEX_NONE && HitSlotGenerations.IsValidIndex(TargetSlot) && HitSlotGenerations[TargetSlot] == SlotGeneration)
+            return true;
+
+        // Also covers registered targets that were hit while they were still unregistered
+        for (const TWeakObjectPtr<AActor>& HitActor : HitOverflow)
+        {
+            if (HitActor.Get() == Actor)
+                return true;
+        }
+        return false;
+    }
+
+    void MarkHit(AActor* Actor, int32 TargetSlot, uint32 SlotGeneration)
+    {
+        if (TargetSlot == INDEX_NONE)
+        {
+            HitOverflow.Add(Actor);
+            return;
+        }
+
+        // Only grows when the target pool does
+        if (TargetSlot >= HitSlotGenerations.Num())
+        {
+            HitSlotGenerations.SetNumZeroed(TargetSlot + 1);
+        }
+        HitSlotGenerations[TargetSlot] = SlotGeneration;
+    }
+};
+
+
 /**
  * Simple socket-driven hitbox (StartSocket → EndSocket).
- * Tick-based sphere sweep while detection is active.
+ * Sphere sweeps while detection is active, batched with every other active hitbox by UMCS_HitboxSweepSubsystem
+ * (the component only ticks itself in worlds without that subsystem).
+ * Up to MaxActiveHitboxes windows can be active at once; all of them are swept in the same pass.
  */
 UCLASS(BlueprintType, ClassGroup = (MotionCombatSystem), meta = (BlueprintSpawnableComponent, DisplayName = "Motion Combat System Hitbox Component"))
 class MOTIONCOMBATSYSTEM_API UMCS_CombatHitboxComponent : public UActorComponent
@@ -49,40 +156,105 @@ public:
      * Functions
      */
     
-    /** Start hit detection (begins ticking sweeps). */
+    /**
+     * Start hit detection for a hitbox window (begins sweeping). A window with the same socket pair restarts;
+     * otherwise the hitbox takes a free slot, replacing the oldest window when all slots are busy.
+     */
     UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
     void StartHitDetection(const FMCS_AttackEntry& Attack, const FMCS_AttackHitbox& Hitbox);
 
-    /** Stop hit detection (stops ticking sweeps). */
+    /** Stop hit detection for every active window (stops sweeping). */
     UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
     void StopHitDetection();
 
+    /** Stop the window using this hitbox's socket pair; the others keep sweeping. */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
+    void StopHitboxWindow(const FMCS_AttackHitbox& Hitbox);
+
     /** Is currently detecting hits? */
     UFUNCTION(BlueprintPure, Category = "MCS|Hitbox")
     bool IsDetecting() const { return bIsDetecting; }
 
+    /** Number of hitbox windows currently sweeping */
+    UFUNCTION(BlueprintPure, Category = "MCS|Hitbox")
+    int32 GetNumActiveHitboxes() const;
+
     /**
-     * Clear the list of already hit actors for the current swing.
+     * Clear the list of already hit actors of every active window.
      * Useful to allow multi-hit within a combo.
      */
     UFUNCTION(BlueprintCallable, Category = "MCS|Hitbox")
-    void ResetAlreadyHit()
-    {
-        AlreadyHitActors.Reset();
-    }
+    void ResetAlreadyHit();
+
+    /** Applies a combat LOD tier's substeps, tick interval and debug drawing (called through the combat core) */
+    void ApplyCombatLOD(const FMCS_CombatLODSettings& Settings);
+
+    /** Whether the component's sweeps resolve asynchronously: only when every active window asks for it (FMCS_AttackHitbox::bAsyncSweep) */
+    bool IsAsyncSweep() const;
+
+    /** Seconds between sweeps (combat LOD; 0 = every frame) */
+    float GetSweepInterval() const { return LODTickInterval; }
+
+    /**
+     * Reads the socket positions once and appends this frame's substep sweeps (previous → current sockets)
+     * for every active window. Used by the hitbox sweep subsystem's gather stage.
+     */
+    void BuildSweepRequests(TArray<FMCS_HitboxSweepRequest>& OutRequests);
+
+    /**
+     * Filters the hits of this component's sweeps (Hits is the batch's flat hit array) and queues them as hit events;
+     * results for replaced windows are dropped. Nothing is broadcast until FlushHitEvents.
+     */
+    void ProcessSweepHits(TArrayView<const FMCS_HitboxSweepRequest> SweepRequests, const TArray<FHitResult>& Hits);
+
+    /** Hits queued since the last flush */
+    TArrayView<const FMCS_HitEvent> GetPendingHitEvents() const { return PendingHitEvents; }
+
+    /** Broadcasts the queued hits as one batch (OnHitEvents), then through OnHitboxHit/OnHitboxWorldHit if anything is bound */
+    void FlushHitEvents();
 
     /*
      * Properties
      */
 
-     // Number of substeps to interpolate between frames
+     // Number of substeps to interpolate between frames (hitboxes with bAdaptiveSubsteps derive theirs from socket travel)
     UPROPERTY(EditAnywhere, Category = "MCS|Hitbox")
     int32 SubstepCount = 2; // 2–4 is usually plenty
 
-    /** Broadcast when a hit is registered. */
+    /**
+     * Deterministic mode: windows with a baked trajectory advance in fixed montage-time steps (FixedStepRate per second
+     * of montage time), several per frame when needed, instead of per-frame substeps. Each step takes the baked blade
+     * at its own montage time, placed by the mesh transform interpolated to that time, so steps do not depend on where
+     * frames fall. An ended window still runs its remaining steps. Analytic target hits keep physics out of the result.
+     */
+    UPROPERTY(EditAnywhere, Category = "MCS|Hitbox|Deterministic")
+    bool bFixedTimestep = false;
+
+    /** Simulation steps per second of montage time */
+    UPROPERTY(EditAnywhere, Category = "MCS|Hitbox|Deterministic", meta = (EditCondition = "bFixedTimestep", ClampMin = "10.0"))
+    float FixedStepRate = 60.0f;
+
+    /** Most steps one window runs per frame; the rest carry over to the next frame */
+    UPROPERTY(EditAnywhere, Category = "MCS|Hitbox|Deterministic", meta = (EditCondition = "bFixedTimestep", ClampMin = "1"))
+    int32 MaxFixedStepsPerFrame = 8;
+
+    /**
+     * Broadcast for each hit, once the frame's sweeps are done (Blueprint adapter over OnHitEvents).
+     * Leave unbound in bulk-processing setups; the per-hit struct copies are skipped then.
+     */
     UPROPERTY(BlueprintAssignable, Category = "MCS|Hitbox")
     FMCS_OnSimpleHitSignature OnHitboxHit;
 
+    /** Broadcast for each world-geometry contact of an analytic hitbox with bSweepWorldGeometry (never through OnHitboxHit) */
+    UPROPERTY(BlueprintAssignable, Category = "MCS|Hitbox")
+    FMCS_OnSimpleHitSignature OnHitboxWorldHit;
+
+    /** Native: this component's hits for the frame in one batch (UMCS_HitboxSweepSubsystem::OnHitEvents has every component's) */
+    FMCS_OnHitEventsNative OnHitEvents;
+
+    /** Hitbox windows that can be active at once */
+    static constexpr int32 MaxActiveHitboxes = 4;
+
 protected:
     /*
      * Functions
@@ -91,7 +263,7 @@ protected:
     /** Called when the game starts */
     virtual void BeginPlay() override;
 
-    /** Called every frame */
+    /** Only used when the world has no hitbox sweep subsystem */
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
@@ -99,18 +271,53 @@ private:
      * Functions
      */
 
-    USkeletalMeshComponent* ResolveMesh() const
-    {
-        if (const AActor* Owner = GetOwner())
-        {
-            return Owner->FindComponentByClass<USkeletalMeshComponent>();
-        }
+    /**
+     * Owner's skeletal mesh, found once and cached. Re-resolves every window's sockets when the
+     * component or its mesh asset changes.
+     */
+    USkeletalMeshComponent* ResolveMesh();
 
-        return nullptr;
-    }
+    /** Resolves a window's Start/End sockets to bone indices and bone-space offsets */
+    static void ResolveWindowSockets(const USkeletalMeshComponent* Mesh, FMCS_ActiveHitboxWindow& Window);
 
+    /** World location of a resolved socket, read from the mesh's component-space bone transforms */
+    static FVector GetSocketWorldLocation(const USkeletalMeshComponent* Mesh, const FTransform& ComponentTransform, const FMCS_ResolvedSocket& Socket, FName SocketName);
+
+    /** Builds, runs and processes this component's sweeps on its own (fallback without the subsystem) */
     void PerformSweep();
 
+    /** Appends one window's substep sweeps */
+    void BuildWindowSweepRequests(USkeletalMeshComponent* Mesh, int32 WindowIndex, TArray<FMCS_HitboxSweepRequest>& OutRequests);
+
+    /** Appends one window's pending fixed steps (deterministic mode) */
+    void BuildFixedStepRequests(USkeletalMeshComponent* Mesh, int32 WindowIndex, TArray<FMCS_HitboxSweepRequest>& OutRequests);
+
+    /** Appends the sweep between two blade positions in the window's sweep shape */
+    void AddBladeRequest(int32 WindowIndex, const FVector& LastStart, const FVector& LastEnd, const FVector& Start, const FVector& End, TArray<FMCS_HitboxSweepRequest>& OutRequests) const;
+
+#if MCS_HITBOX_DEBUG_DRAW
+    /** Line buffer to draw this hitbox into, or null when mcs.Hitbox.Debug, its actor filter or combat LOD rule it out */
+    FMCS_HitboxDebugBatch* GetDebugBatch(const FMCS_AttackHitbox& Hitbox) const;
+#endif
+
+    /** Deterministic mode applies to windows with a baked trajectory; the others keep per-frame substeps */
+    bool UsesFixedTimestep(const FMCS_ActiveHitboxWindow& Window) const { return bFixedTimestep && Window.Hitbox.HasBakedTrajectory(); }
+
+    /** Ends a window (fixed-step windows first run their remaining steps) */
+    void StopWindow(FMCS_ActiveHitboxWindow& Window) const;
+
+    /** Substeps for this tick: adaptive from socket travel or fixed, then clamped by combat LOD and the global cap */
+    int32 ComputeSubstepCount(const FMCS_ActiveHitboxWindow& Window, const FVector& CurrStart, const FVector& CurrEnd) const;
+
+    /** Current position of the window's attack montage relative to its baked window start; false if it is not playing */
+    static bool GetBakedWindowTime(const USkeletalMeshComponent* Mesh, const FMCS_ActiveHitboxWindow& Window, float& OutWindowTime);
+
+    /** Slot for a starting window: same socket pair, else a free slot, else the oldest window */
+    int32 FindWindowSlot(const FMCS_AttackHitbox& Hitbox) const;
+
+    /** Recomputes bIsDetecting and leaves the sweep batch (or stops ticking) once no window is active */
+    void UpdateDetecting();
+
     /*
      * Properties
      */
@@ -118,16 +325,48 @@ private:
     // Is currently detecting hits?
     bool bIsDetecting = false;
 
-    // Cached from AttackType when StartHitDetection is called
-    FMCS_AttackEntry ActiveAttack;
+    // Last serial handed to a window (serials start at 1; 0 marks a never-used slot)
+    uint32 WindowSerial = 0;
 
-    // Cached hitbox
-    FMCS_AttackHitbox ActiveHitbox;
+    // Active (and recently stopped) hitbox windows
+    TStaticArray<FMCS_ActiveHitboxWindow, MaxActiveHitboxes> Windows;
 
-    // Previous frame socket positions
-    FVector PrevStartLoc = FVector::ZeroVector;
-    FVector PrevEndLoc = FVector::ZeroVector;
+    // Substeps forced by the current combat LOD tier (0 = SubstepCount)
+    int32 LODSubstepCount = 0;
+
+    // Whether the current combat LOD tier allows debug drawing
+    bool bLODAllowDebugDraw = true;
+
+    // Sweep interval forced by the current combat LOD tier
+    float LODTickInterval = 0.0f;
+
+    // Hits waiting for FlushHitEvents, and the buffer being broadcast (listeners may queue new windows meanwhile)
+    TArray<FMCS_HitEvent> PendingHitEvents;
+    TArray<FMCS_HitEvent> DispatchingHitEvents;
+
+    // Attack of each window slot with queued hits, copied on its first hit (bit set in PendingHitAttackMask).
+    // Sized once and swapped with the event buffers, so the events' Attack pointers stay valid through the broadcast.
+    TArray<FMCS_AttackEntry> PendingHitAttacks;
+    TArray<FMCS_AttackEntry> DispatchingHitAttacks;
+    uint32 PendingHitAttackMask = 0;
+
+    // Reused by the fallback sweep path (no subsystem) so it does not allocate per tick
+    TArray<FMCS_HitboxSweepRequest> ScratchRequests;
+    TArray<FHitResult> ScratchHits;
+    FMCS_HitboxSweepScratch SweepScratch;
+
+#if MCS_HITBOX_DEBUG_DRAW
+    // Debug lines of the fallback sweep path, flushed each tick (batched components draw into the subsystem's buffer)
+    mutable FMCS_HitboxDebugBatch DebugBatch;
+#endif
+
+    // Owner's skeletal mesh and the asset the windows' sockets were resolved against
+    TWeakObjectPtr<USkeletalMeshComponent> CachedMesh;
+    TWeakObjectPtr<const USkinnedAsset> ResolvedMeshAsset;
+
+    // Batches this component's sweeps with every other active hitbox (null in worlds without it)
+    TWeakObjectPtr<UMCS_HitboxSweepSubsystem> SweepSubsystem;
 
-    // Prevent hitting same actor multiple times in one swing
-    TSet<TWeakObjectPtr<AActor>> AlreadyHitActors;
+    // Targeting subsystem, used to skip allies excluded by the owner's team filter
+    TWeakObjectPtr<UMCS_TargetingSubsystem> TargetingSubsystem;
 };
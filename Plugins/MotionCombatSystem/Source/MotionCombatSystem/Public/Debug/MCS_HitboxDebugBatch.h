@@ -0,0 +1,64 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxDebugBatch.h
+ * Hitbox visualization gated by the mcs.Hitbox.Debug console variables. Primitives are collected
+ * into one line buffer and handed to the world's line batcher once per frame.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EngineDefines.h"
+
+// Hitbox debug drawing (and this whole file) is compiled out of shipping builds
+#define MCS_HITBOX_DEBUG_DRAW (ENABLE_DRAW_DEBUG && !UE_BUILD_SHIPPING)
+
+#if MCS_HITBOX_DEBUG_DRAW
+
+#include "Components/LineBatchComponent.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * One frame's hitbox debug lines. The sweep subsystem owns the shared buffer; components sweeping
+ * on their own (no subsystem in the world) keep one each.
+ */
+class MOTIONCOMBATSYSTEM_API FMCS_HitboxDebugBatch
+{
+public:
+    /**
+     * Whether a hitbox on this actor is drawn: mcs.Hitbox.Debug 1 draws hitboxes flagged bDebugDraw, 2 draws every hitbox,
+     * and a non-empty mcs.Hitbox.DebugFilter keeps only actors whose name contains it.
+     */
+    static bool ShouldDraw(const AActor* Owner, bool bHitboxDebugDraw);
+
+    void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness = 0.0f);
+    void AddSphere(const FVector& Center, float Radius, const FColor& Color, int32 Segments = 12);
+
+    /** Capsule along the rotation's Z axis (HalfHeight includes the caps) */
+    void AddCapsule(const FVector& Center, float HalfHeight, float Radius, const FQuat& Rotation, const FColor& Color, int32 Segments = 12);
+
+    /** Hands the buffered lines to the world's line batcher in one call and empties the buffer */
+    void Flush(UWorld* World);
+
+private:
+    /** Arc of a circle spanned by AxisA/AxisB, from StartAngle to EndAngle (radians) */
+    void AddArc(const FVector& Center, const FVector& AxisA, const FVector& AxisB, float Radius, float StartAngle, float EndAngle, int32 Segments, const FColor& Color);
+
+    /** Lines kept until Flush; the storage is reused across frames */
+    TArray<FBatchedLine> Lines;
+};
+
+#endif // MCS_HITBOX_DEBUG_DRAW
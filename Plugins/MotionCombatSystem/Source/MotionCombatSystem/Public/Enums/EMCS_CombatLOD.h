@@ -0,0 +1,29 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * EMCS_CombatLOD.h
+ * Declares the EMCS_CombatLOD enum, the fidelity tiers assigned to combatants by significance.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Combat LOD"))
+enum class EMCS_CombatLOD : uint8
+{
+    High     UMETA(DisplayName = "High"),
+    Medium   UMETA(DisplayName = "Medium"),
+    Low      UMETA(DisplayName = "Low"),
+    Dormant  UMETA(DisplayName = "Dormant")
+};
@@ -0,0 +1,30 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * EMCS_HitboxSweepShape.h
+ * Declares the EMCS_HitboxSweepShape enum, the query a hitbox issues for each substep.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Hitbox Sweep Shape"))
+enum class EMCS_HitboxSweepShape : uint8
+{
+    // Sphere swept from the start socket to the end socket: the blade line at one instant
+    BladeLine     UMETA(DisplayName = "Blade Line"),
+
+    // Blade-aligned capsule swept from the previous substep's blade to the current one: the area between substeps
+    SweptCapsule  UMETA(DisplayName = "Swept Capsule")
+};
@@ -0,0 +1,27 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * EMCS_TargetCycleDirection.h
+ * Declares the EMCS_TargetCycleDirection enum used to switch lock-on targets.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+UENUM(BlueprintType, meta = (DisplayName = "Motion Combat System Target Cycle Direction"))
+enum class EMCS_TargetCycleDirection : uint8
+{
+    Left   UMETA(DisplayName = "Left"),
+    Right  UMETA(DisplayName = "Right")
+};
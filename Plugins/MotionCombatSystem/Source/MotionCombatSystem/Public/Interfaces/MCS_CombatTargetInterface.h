@@ -36,8 +36,19 @@ class MOTIONCOMBATSYSTEM_API IMCS_CombatTargetInterface
     GENERATED_BODY()
 
 public:
-    /** Whether this actor can currently be targeted (true = valid target). */
+    /**
+     * Whether this actor can currently be targeted (true = valid target).
+     * Actors that report changes through UMCS_TargetingSubsystem::NotifyTargetabilityChanged are not polled again.
+     */
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Combat Target")
     bool CanBeTargeted() const;
     virtual bool CanBeTargeted_Implementation() const { return true; }
+
+    /**
+     * Team/faction bits this actor belongs to (0 = no team). Read once when the actor joins the target pool;
+     * push later changes through UMCS_TargetingSubsystem::SetTargetTeamMask.
+     */
+    UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Combat Target")
+    int32 GetCombatTeamMask() const;
+    virtual int32 GetCombatTeamMask_Implementation() const { return 0; }
 };
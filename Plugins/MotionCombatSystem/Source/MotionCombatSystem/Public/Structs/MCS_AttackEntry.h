@@ -108,6 +108,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Montage", meta = (ClampMin = "0.0", DisplayName = "Blend Out Time"))
 	float BlendOutTime = 0.20f;
 
+	/**
+	 * Seconds from attack start to impact, used to predict where targets will be when choosing this attack.
+	 * Negative = derived from the first hitbox window in the montage.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Attack|Montage", meta = (DisplayName = "Hit Lookahead Override"))
+	float HitLookaheadOverride = -1.0f;
+
 	/* ---------------------------
 	 * Gameplay values
 	 * --------------------------- */
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <Enums/EMCS_HitboxSweepShape.h>
 #include "MCS_AttackHitbox.generated.h"
 
 USTRUCT(BlueprintType, Blueprintable, meta = (DisplayName = "Motion Combat System Attack Hitbox", Description = "Represents an attack hitbox in the MCS Combat System"))
@@ -39,7 +40,123 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox", meta = (ClampMin = "0.0", DisplayName = "Radius", Description = "Radius of the hitbox sphere sweep"))
     float Radius = 10.f;
 
-    /** Debug draw toggle for this attack. */
+    /**
+     * Query issued per substep. Swept Capsule covers the area the blade passes through between substeps,
+     * so it stays accurate with fewer substeps (a SubstepSpacing of 3-4 is usually enough).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox", meta = (DisplayName = "Sweep Shape"))
+    EMCS_HitboxSweepShape SweepShape = EMCS_HitboxSweepShape::BladeLine;
+
+    /**
+     * Test the surface the blade swept between substeps against the cached capsules of registered combat targets (UMCS_TargetingSubsystem snapshot)
+     * instead of sweeping the physics scene for pawns. Pawns that are not registered targets are not hit.
+     * Analytic hitboxes always resolve synchronously (bAsyncSweep is ignored).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Analytic", meta = (DisplayName = "Analytic Target Hits"))
+    bool bAnalyticTargetHits = false;
+
+    /**
+     * With analytic target hits, also sweep world geometry (static and dynamic) so the blade can strike walls and props.
+     * Off by default, so analytic hitboxes never touch the physics scene. World contacts are reported apart from
+     * combatant hits (FMCS_HitEvent::bWorldGeometry, OnHitboxWorldHit).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Analytic", meta = (DisplayName = "Sweep World Geometry", EditCondition = "bAnalyticTargetHits"))
+    bool bSweepWorldGeometry = false;
+
+    /** Derive the substep count each tick from how far the sockets moved (otherwise the component's fixed SubstepCount). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Substeps", meta = (DisplayName = "Adaptive Substeps"))
+    bool bAdaptiveSubsteps = true;
+
+    /** Largest socket travel per substep, as a multiple of Radius (1 = consecutive spheres just touch). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Substeps", meta = (ClampMin = "0.1", EditCondition = "bAdaptiveSubsteps"))
+    float SubstepSpacing = 1.0f;
+
+    /** Fewest substeps per tick, even for slow motion. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Substeps", meta = (ClampMin = "1", EditCondition = "bAdaptiveSubsteps"))
+    int32 MinSubsteps = 1;
+
+    /** Most substeps per tick for this attack (the global mcs.Hitbox.MaxSubsteps cap still applies). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Substeps", meta = (ClampMin = "1", EditCondition = "bAdaptiveSubsteps"))
+    int32 MaxSubsteps = 8;
+
+    /**
+     * Resolve this hitbox's sweeps asynchronously: sweeps issued in frame N report hits in frame N+1, off the game thread.
+     * Leave off for fast jabs that cannot afford the extra frame of latency.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox", meta = (DisplayName = "Async Sweep", Description = "Resolve sweeps asynchronously with one frame of latency"))
+    bool bAsyncSweep = false;
+
+    /** Debug draw toggle for this attack (drawn when mcs.Hitbox.Debug is 1; 2 draws every hitbox, 0 none). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox", meta = (DisplayName = "Debug Draw", Description = "Enable debug drawing for this hitbox"))
     bool bDebugDraw = true;
+
+    /**
+     * Sample the window's socket trajectory from the montage when it is saved or cooked.
+     * The hitbox then evaluates the baked curve at the montage time instead of reading sockets from the mesh,
+     * which gives exact arcs at any frame rate. Leave off when layered blends or IK change the weapon path at runtime.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Baked Trajectory", meta = (DisplayName = "Bake Trajectory"))
+    bool bBakeTrajectory = false;
+
+    /** Samples per second when baking (the interval is shortened so the window end is always a sample). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hitbox|Baked Trajectory", meta = (ClampMin = "30.0", EditCondition = "bBakeTrajectory"))
+    float BakeSampleRate = 120.0f;
+
+    /** Montage time the baked samples start at (the window's trigger time). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hitbox|Baked Trajectory")
+    float BakedWindowStart = 0.0f;
+
+    /** Seconds between baked samples (0 = nothing baked). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hitbox|Baked Trajectory")
+    float BakedSampleInterval = 0.0f;
+
+    /** Component-space positions of the start/end sockets, one per sample. */
+    UPROPERTY(VisibleAnywhere, Category = "Hitbox|Baked Trajectory")
+    TArray<FVector3f> BakedStartPositions;
+
+    UPROPERTY(VisibleAnywhere, Category = "Hitbox|Baked Trajectory")
+    TArray<FVector3f> BakedEndPositions;
+
+    /*
+     * Functions
+     */
+
+    /** Whether a usable baked trajectory is present */
+    bool HasBakedTrajectory() const
+    {
+        return bBakeTrajectory && BakedSampleInterval > 0.0f && BakedStartPositions.Num() >= 2 && BakedStartPositions.Num() == BakedEndPositions.Num();
+    }
+
+    /** Drops the baked samples */
+    void ClearBakedTrajectory()
+    {
+        BakedWindowStart = 0.0f;
+        BakedSampleInterval = 0.0f;
+        BakedStartPositions.Reset();
+        BakedEndPositions.Reset();
+    }
+
+    /**
+     * Evaluates the baked component-space socket positions at a time relative to the window start
+     * (uniform Catmull-Rom through the samples, clamped to the window).
+     */
+    void EvaluateBakedTrajectory(float WindowTime, FVector& OutStart, FVector& OutEnd) const
+    {
+        const int32 LastSample = BakedStartPositions.Num() - 1;
+        const float Sample = FMath::Clamp(WindowTime / BakedSampleInterval, 0.0f, static_cast<float>(LastSample));
+        const int32 I1 = FMath::Min(FMath::FloorToInt(Sample), LastSample - 1);
+        const int32 I0 = FMath::Max(I1 - 1, 0);
+        const int32 I2 = I1 + 1;
+        const int32 I3 = FMath::Min(I1 + 2, LastSample);
+        const float T = Sample - I1;
+
+        auto CatmullRom = [ I0, I1, I2, I3, T ] (const TArray<FVector3f>& Points)
+            {
+                const FVector P0(Points[I0]), P1(Points[I1]), P2(Points[I2]), P3(Points[I3]);
+                return 0.5f * ((2.0f * P1) + (P2 - P0) * T + (2.0f * P0 - 5.0f * P1 + 4.0f * P2 - P3) * (T * T) + (3.0f * P1 - P0 - 3.0f * P2 + P3) * (T * T * T));
+            };
+
+        OutStart = CatmullRom(BakedStartPositions);
+        OutEnd = CatmullRom(BakedEndPositions);
+    }
 };
\ No newline at end of file
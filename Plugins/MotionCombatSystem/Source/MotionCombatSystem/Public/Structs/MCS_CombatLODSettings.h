@@ -0,0 +1,55 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_CombatLODSettings.h
+ * Declares the FMCS_CombatLODSettings struct: what one combat LOD tier costs (sweep substeps,
+ * chooser scoring, targeting refresh and tick rates).
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCS_CombatLODSettings.generated.h"
+
+/**
+ * Fidelity settings for one combat LOD tier.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Combat LOD Settings"))
+struct MOTIONCOMBATSYSTEM_API FMCS_CombatLODSettings
+{
+    GENERATED_BODY()
+
+    /** Combatants up to this distance from the nearest view use this tier (off-screen distances are scaled first). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD", meta = (ClampMin = "0.0"))
+    float MaxDistance = 0.0f;
+
+    /** Hitbox sweep substeps per tick (0 = the hitbox component's own SubstepCount). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD", meta = (ClampMin = "0"))
+    int32 SubstepCount = 0;
+
+    /** Score every attack on each selection; when off, the last pick for the same type and direction is reused. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD")
+    bool bFullChooserScoring = true;
+
+    /** Seconds between target ranking refreshes (0 = every frame). Membership changes always refresh. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD", meta = (ClampMin = "0.0"))
+    float TargetingRefreshInterval = 0.0f;
+
+    /** Hitbox component tick interval while detecting (0 = every frame). Sweeps still cover the whole interval. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD", meta = (ClampMin = "0.0"))
+    float TickInterval = 0.0f;
+
+    /** Allow hitbox debug drawing in this tier. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat LOD")
+    bool bAllowDebugDraw = true;
+};
@@ -0,0 +1,62 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitEvent.h
+ * Declares FMCS_HitEvent, one confirmed hitbox hit, and the native delegate that delivers
+ * a frame's hits in one batch.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+
+class AActor;
+class UMCS_CombatHitboxComponent;
+struct FMCS_AttackEntry;
+
+/**
+ * One confirmed hit (already filtered for self, duplicates and allies). Batches are only valid during the broadcast.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_HitEvent
+{
+    /** Actor that was hit */
+    AActor* HitActor = nullptr;
+
+    /** Hitbox component that landed the hit (its owner is the attacker) */
+    UMCS_CombatHitboxComponent* Hitbox = nullptr;
+
+    /**
+     * Attack of the window that hit, copied when the hit was queued, so listeners that start or stop windows during
+     * the broadcast do not change it. Only valid during the broadcast; copy it to keep it.
+     */
+    const FMCS_AttackEntry* Attack = nullptr;
+
+    FHitResult Hit;
+
+    /** Hit actor's target slot in the targeting snapshot (INDEX_NONE if it is not a registered target) */
+    int32 TargetSlot = INDEX_NONE;
+
+    /** Window slot on the hitbox component that landed the hit, and the serial of the window in it at the time */
+    int32 WindowIndex = INDEX_NONE;
+    uint32 WindowSerial = 0;
+
+    /** Frame the sweep that found the hit was built on (GFrameCounter); async hits arrive a frame later but keep it */
+    uint64 FrameNumber = 0;
+
+    /** The blade struck world geometry (analytic hitbox with bSweepWorldGeometry), not a combatant */
+    bool bWorldGeometry = false;
+};
+
+/** A batch of hits, delivered once per frame after every sweep has run */
+DECLARE_MULTICAST_DELEGATE_OneParam(FMCS_OnHitEventsNative, TArrayView<const FMCS_HitEvent>);
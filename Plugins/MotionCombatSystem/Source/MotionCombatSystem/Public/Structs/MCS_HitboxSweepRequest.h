@@ -0,0 +1,78 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxSweepRequest.h
+ * Declares FMCS_HitboxSweepRequest, one substep sweep submitted by a hitbox component to the
+ * hitbox sweep subsystem's per-frame batch.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionShape.h"
+#include "Engine/HitResult.h"
+#include <Utils/MCS_CombatMath.h>
+
+/**
+ * One sweep in the frame's batch. Results land in the batch's flat hit array at [FirstHit, FirstHit + NumHits).
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_HitboxSweepRequest
+{
+    /** Path of the shape's center */
+    FVector Start = FVector::ZeroVector;
+    FVector End = FVector::ZeroVector;
+    float Radius = 0.0f;
+
+    /** Capsule half height including the caps (0 = sphere) and the capsule's orientation (Z along the blade) */
+    float HalfHeight = 0.0f;
+    FQuat Rotation = FQuat::Identity;
+
+    /** Blade segment at this substep (tested against target capsules in analytic mode) */
+    FVector BladeStart = FVector::ZeroVector;
+    FVector BladeEnd = FVector::ZeroVector;
+
+    /** Blade segment at the previous substep; analytic mode tests the surface swept from it to BladeStart/BladeEnd */
+    FVector PrevBladeStart = FVector::ZeroVector;
+    FVector PrevBladeEnd = FVector::ZeroVector;
+
+    /** Analytic mode: test the blade against snapshot capsules; scene query then only covers world geometry (if at all) */
+    bool bAnalyticTargets = false;
+    bool bSweepWorldGeometry = false;
+
+    /** Hitbox window slot on the owning component and the serial of the window that built the request */
+    int32 WindowIndex = INDEX_NONE;
+    uint32 WindowSerial = 0;
+
+    /** Frame the sweep was built on (GFrameCounter), passed on to its hit events; async results are dispatched in issue order */
+    uint64 FrameNumber = 0;
+
+    /** Filled by the batch; the last NumWorldHits of the request's hits are world geometry (analytic mode only) */
+    int32 FirstHit = 0;
+    int32 NumHits = 0;
+    int32 NumWorldHits = 0;
+
+    FORCEINLINE FCollisionShape GetShape() const
+    {
+        return HalfHeight > Radius ? FCollisionShape::MakeCapsule(Radius, HalfHeight) : FCollisionShape::MakeSphere(Radius);
+    }
+};
+
+/**
+ * Per-query scratch storage kept by each caller of UMCS_HitboxSweepSubsystem::RunSweeps, so the steady-state
+ * sweep loop reuses its buffers instead of allocating them every substep.
+ */
+struct FMCS_HitboxSweepScratch
+{
+    TArray<FHitResult> StepHits;
+    TArray<FMCS_CapsuleContact> Contacts;
+};
@@ -31,9 +31,30 @@ struct FMCS_TargetInfo
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Targeting")
     TObjectPtr<AActor> TargetActor = nullptr;
 
+    /** Distance to the querier that owns this entry (nearest querier for the shared pool). Refreshed every frame. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Targeting")
     float DistanceFromPlayer = 0.0f;
 
+    /** Stable index into the subsystem's per-frame target snapshot while the target stays registered */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    int32 TargetSlot = INDEX_NONE;
+
+    /** Team/faction bits of the target (IMCS_CombatTargetInterface::GetCombatTeamMask) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting", meta = (Bitmask))
+    int32 TeamMask = 0;
+
+    /** World time (seconds) this entry joined its list; used for the minimum residency time */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    float EnteredTime = 0.0f;
+
+    /** Whether the owning querier can see this target (neighborhood entries; true until first checked or with LOS disabled) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    bool bHasLineOfSight = true;
+
+    /** World time of the line-of-sight result above (negative = never checked) */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    float LastVisibilityCheckTime = -1.0f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Targeting")
     bool bIsValid = false;
 };
\ No newline at end of file
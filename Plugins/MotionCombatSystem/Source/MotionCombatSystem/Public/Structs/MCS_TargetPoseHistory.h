@@ -0,0 +1,128 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_TargetPoseHistory.h
+ * Declares FMCS_TargetPoseHistory, the ring buffer of timestamped target capsules the targeting
+ * subsystem records so servers can rewind targets to a client's view time.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Structs/MCS_TargetSnapshot.h>
+
+/**
+ * Target capsules over the last Capacity frames. Storage is slot-major (Slot * Capacity + Frame), so one target's
+ * history is contiguous and growing the target pool never moves recorded frames.
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_TargetPoseHistory
+{
+    /** Frames kept, world time of each frame, newest frame index and number of recorded frames */
+    int32 Capacity = 0;
+    TArray<double> Timestamps;
+    int32 Newest = INDEX_NONE;
+    int32 NumFrames = 0;
+
+    /** Per slot and frame: capsule center, half height and the slot generation that owned it (0 = empty) */
+    TArray<FVector> Centers;
+    TArray<float> HalfHeights;
+    TArray<uint32> Generations;
+
+    /*
+     * Functions
+     */
+
+    /** Drops all frames and sets the number of frames kept */
+    void Reset(int32 InCapacity)
+    {
+        Capacity = FMath::Max(InCapacity, 0);
+        Timestamps.SetNumZeroed(Capacity);
+        Newest = INDEX_NONE;
+        NumFrames = 0;
+        Centers.Reset();
+        HalfHeights.Reset();
+        Generations.Reset();
+    }
+
+    /** World time of the oldest recorded frame (0 if nothing is recorded) */
+    double GetOldestTime() const
+    {
+        return NumFrames > 0 ? Timestamps[(Newest - NumFrames + 1 + Capacity) % Capacity] : 0.0;
+    }
+
+    /** Records every slot of the snapshot as the newest frame, overwriting the oldest once full */
+    void Record(double Time, const FMCS_TargetSnapshot& Snapshot)
+    {
+        if (Capacity <= 0)
+            return;
+
+        const int32 NumSlots = Snapshot.Num();
+        if (Centers.Num() < NumSlots * Capacity)
+        {
+            Centers.SetNumZeroed(NumSlots * Capacity);
+            HalfHeights.SetNumZeroed(NumSlots * Capacity);
+            Generations.SetNumZeroed(NumSlots * Capacity);
+        }
+
+        Newest = (Newest + 1) % Capacity;
+        NumFrames = FMath::Min(NumFrames + 1, Capacity);
+        Timestamps[Newest] = Time;
+
+        for (int32 Slot = 0, Index = Newest; Slot < NumSlots; ++Slot, Index += Capacity)
+        {
+            Generations[Index] = Snapshot.Occupied[Slot] ? Snapshot.SlotGenerations[Slot] : 0;
+            Centers[Index] = Snapshot.Locations[Slot];
+            HalfHeights[Index] = Snapshot.CapsuleHalfHeights[Slot];
+        }
+    }
+
+    /**
+     * Capsule center and half height of a slot at a past time, interpolated between the two recorded frames around it.
+     * Fails when the time is older than the history or the slot had another occupant (generation) in between.
+     */
+    bool Sample(int32 Slot, uint32 Generation, double Time, FVector& OutCenter, float& OutHalfHeight) const
+    {
+        if (NumFrames == 0 || Generation == 0 || Slot < 0 || (Slot + 1) * Capacity > Centers.Num())
+            return false;
+
+        // Walk back from the newest frame to the first one at or before Time
+        const int32 Base = Slot * Capacity;
+        int32 Later = INDEX_NONE;
+        for (int32 Age = 0; Age < NumFrames; ++Age)
+        {
+            const int32 Frame = (Newest - Age + Capacity) % Capacity;
+            if (Generations[Base + Frame] != Generation)
+                return false;
+
+            if (Timestamps[Frame] <= Time)
+            {
+                if (Later == INDEX_NONE)
+                {
+                    OutCenter = Centers[Base + Frame];
+                    OutHalfHeight = HalfHeights[Base + Frame];
+                    return true;
+                }
+
+                const double Span = Timestamps[Later] - Timestamps[Frame];
+                const float Alpha = Span > 0.0 ? static_cast<float>((Time - Timestamps[Frame]) / Span) : 0.0f;
+                OutCenter = FMath::Lerp(Centers[Base + Frame], Centers[Base + Later], Alpha);
+                OutHalfHeight = FMath::Lerp(HalfHeights[Base + Frame], HalfHeights[Base + Later], Alpha);
+                return true;
+            }
+
+            Later = Frame;
+        }
+
+        return false;
+    }
+};
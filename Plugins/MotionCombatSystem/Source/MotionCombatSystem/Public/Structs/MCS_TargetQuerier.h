@@ -0,0 +1,136 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_TargetQuerier.h
+ * Declares the FMCS_TargetQuerier struct the targeting subsystem keeps for every combatant
+ * (player, AI or remote pawn) that asks for its own target neighborhood.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <Structs/MCS_TargetInfo.h>
+#include "MCS_TargetQuerier.generated.h"
+
+class AActor;
+class UMCS_CombatCoreComponent;
+
+/**
+ * Per-instigator targeting state. Neighborhoods are rebuilt from the subsystem's shared target grid.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Target Querier"))
+struct MOTIONCOMBATSYSTEM_API FMCS_TargetQuerier
+{
+    GENERATED_BODY()
+
+    /** Combatant that owns this neighborhood. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    TWeakObjectPtr<AActor> Instigator = nullptr;
+
+    /** Targets within ScanRadius of the instigator. DistanceFromPlayer is relative to this instigator. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    TArray<FMCS_TargetInfo> Neighborhood;
+
+    /** Instigator location when the last scan started; drives the adaptive scan interval. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    FVector LastScanLocation = FVector::ZeroVector;
+
+    /** Targets must share at least one bit with this mask (0 = any team, including teamless targets). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting", meta = (Bitmask))
+    int32 IncludeTeamMask = 0;
+
+    /** Targets sharing any bit with this mask are skipped (allies). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting", meta = (Bitmask))
+    int32 ExcludeTeamMask = 0;
+
+    /** Also skip targets on the instigator's current team (OwnTeamMask follows SetTargetTeamMask pushes). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    bool bExcludeOwnTeam = false;
+
+    /** Instigator's own team mask, kept current by the subsystem. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting", meta = (Bitmask))
+    int32 OwnTeamMask = 0;
+
+    /** Instigator's combat core (if any), queried for attack state. */
+    TWeakObjectPtr<UMCS_CombatCoreComponent> CombatCore;
+
+    /** Cached line-of-sight result per target slot (set bit = blocked) */
+    TBitArray<> OccludedSlots;
+
+    /** World time of each slot's line-of-sight result (negative = never checked) */
+    TArray<float> VisibilityCheckTimes;
+
+    /** Target the instigator is locked on to (cleared when it leaves the neighborhood). */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Targeting")
+    TWeakObjectPtr<AActor> LockedTarget = nullptr;
+
+    /** Neighborhood slots ordered by ranking score, best first (kept sorted incrementally) */
+    TArray<int32> RankedSlots;
+
+    /** Neighborhood slots ordered by view bearing, left to right */
+    TArray<int32> BearingSortedSlots;
+
+    /** Per slot: ranking score, signed view bearing (degrees), index in BearingSortedSlots */
+    TArray<float> SlotScores;
+    TArray<float> SlotViewBearings;
+    TArray<int32> SlotBearingOrder;
+
+    /** World time this instigator last engaged each slot (negative = never) */
+    TArray<float> EngagedTimes;
+
+    /** Neighborhood membership changed since the ranking was last rebuilt */
+    bool bRankingDirty = true;
+
+    /** Neighborhood membership changed since the combat core was last notified */
+    bool bNeighborhoodChanged = false;
+
+    /** Seconds between ranking refreshes (combat LOD; 0 = every frame) and the world time of the next one */
+    float RankingRefreshInterval = 0.0f;
+    float NextRankingTime = 0.0f;
+
+    /** Include/exclude test shared by every targeting query */
+    static FORCEINLINE bool PassesTeamFilter(int32 TeamMask, int32 Include, int32 Exclude)
+    {
+        return (TeamMask & Exclude) == 0 && (Include == 0 || (TeamMask & Include) != 0);
+    }
+
+    FORCEINLINE bool AcceptsTeamMask(int32 TeamMask) const
+    {
+        return PassesTeamFilter(TeamMask, IncludeTeamMask, ExcludeTeamMask | (bExcludeOwnTeam ? OwnTeamMask : 0));
+    }
+
+    /**
+     * Drops a released target slot from the neighborhood and the rankings right away. The slot can be handed to
+     * another actor before the next ranking update, and that actor must never be returned in the old one's place.
+     */
+    void ForgetSlot(int32 Slot)
+    {
+        const int32 Removed = Neighborhood.RemoveAll([ Slot ] (const FMCS_TargetInfo& Info) { return Info.TargetSlot == Slot; });
+        const bool bWasRanked = RankedSlots.RemoveSingle(Slot) > 0;
+
+        // RemoveSingle keeps both orders sorted; only the bearing positions after the hole shift
+        if (BearingSortedSlots.RemoveSingle(Slot) > 0)
+        {
+            for (int32 Order = 0; Order < BearingSortedSlots.Num(); ++Order)
+            {
+                if (SlotBearingOrder.IsValidIndex(BearingSortedSlots[Order]))
+                {
+                    SlotBearingOrder[BearingSortedSlots[Order]] = Order;
+                }
+            }
+        }
+
+        bRankingDirty |= Removed > 0 || bWasRanked;
+        bNeighborhoodChanged |= Removed > 0;
+    }
+};
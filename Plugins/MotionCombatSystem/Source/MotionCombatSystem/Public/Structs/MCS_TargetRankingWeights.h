@@ -0,0 +1,55 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_TargetRankingWeights.h
+ * Declares the FMCS_TargetRankingWeights struct the targeting subsystem uses to rank lock-on and
+ * soft-targeting candidates.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCS_TargetRankingWeights.generated.h"
+
+/**
+ * Weights for the per-instigator target ranking. Each term is normalized to [0, 1] before weighting.
+ */
+USTRUCT(BlueprintType, meta = (DisplayName = "Motion Combat System Target Ranking Weights"))
+struct MOTIONCOMBATSYSTEM_API FMCS_TargetRankingWeights
+{
+    GENERATED_BODY()
+
+    /** Closer targets score higher (1 at the instigator, 0 at the exit radius). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking", meta = (ClampMin = "0.0"))
+    float DistanceWeight = 1.0f;
+
+    /** Targets closer to the view direction score higher (1 straight ahead, 0 directly behind). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking", meta = (ClampMin = "0.0"))
+    float AngleWeight = 1.5f;
+
+    /** Threat pushed through SetTargetThreat (0-1). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking", meta = (ClampMin = "0.0"))
+    float ThreatWeight = 0.5f;
+
+    /** Targets this instigator engaged recently score higher (decays with RecencyHalfLife). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking", meta = (ClampMin = "0.0"))
+    float RecencyWeight = 0.5f;
+
+    /** Seconds for the recency term to fall to half. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking", meta = (ClampMin = "0.01"))
+    float RecencyHalfLife = 3.0f;
+
+    /** Measure angles from the view (camera/control) rotation instead of the actor's forward. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ranking")
+    bool bUseViewRotation = true;
+};
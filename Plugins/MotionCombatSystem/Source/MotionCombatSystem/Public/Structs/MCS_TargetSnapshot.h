@@ -0,0 +1,135 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_TargetSnapshot.h
+ * Declares FMCS_TargetSnapshot, the structure-of-arrays view of every registered target that the
+ * targeting subsystem publishes once per frame. Combat consumers (chooser, core, hitboxes) read
+ * positions and distances from here instead of touching AActor memory scattered across the heap.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+/**
+ * Per-frame target snapshot. Target arrays are indexed by target slot (FMCS_TargetInfo::TargetSlot);
+ * querier arrays are indexed by querier index, and pairwise data by (QuerierIndex * Num() + Slot).
+ */
+struct MOTIONCOMBATSYSTEM_API FMCS_TargetSnapshot
+{
+    /* ---------------------------
+     * Per target (indexed by slot)
+     * --------------------------- */
+
+    /** Actor occupying each slot (stale entries fail IsValid) */
+    TArray<TWeakObjectPtr<AActor>> Actors;
+
+    /** Whether the slot is currently in use */
+    TBitArray<> Occupied;
+
+    TArray<FVector> Locations;
+    TArray<FVector> Velocities;
+    TArray<FVector> Forwards;
+    TArray<float> CapsuleRadii;
+    TArray<float> CapsuleHalfHeights;
+
+    /** Designer/AI-driven threat in [0, 1], pushed through UMCS_TargetingSubsystem::SetTargetThreat */
+    TArray<float> Threats;
+
+    /** Team/faction bits per slot, tested against querier include/exclude masks */
+    TArray<int32> TeamMasks;
+
+    /** Incremented every time a slot gets a new occupant, so recorded history can tell occupants apart */
+    TArray<uint32> SlotGenerations;
+
+    /** Slot lookup for consumers that only hold an actor pointer */
+    TMap<TObjectKey<AActor>, int32> SlotByActor;
+
+    /* ---------------------------
+     * Per querier
+     * --------------------------- */
+
+    TArray<TWeakObjectPtr<AActor>> QuerierActors;
+    TArray<FVector> QuerierLocations;
+    TArray<FVector> QuerierForwards;
+
+    /** Distance from each querier to each slot (FLT_MAX for empty slots) */
+    TArray<float> Distances;
+
+    /** Signed yaw from each querier's forward to each slot in degrees (positive = right) */
+    TArray<float> Bearings;
+
+    /** Frame this snapshot was captured on (GFrameCounter) */
+    uint64 FrameNumber = 0;
+
+    /*
+     * Functions
+     */
+
+    /** Number of target slots (including free ones) */
+    FORCEINLINE int32 Num() const { return Locations.Num(); }
+
+    FORCEINLINE bool IsSlotValid(int32 Slot) const
+    {
+        return Occupied.IsValidIndex(Slot) && Occupied[Slot];
+    }
+
+    /** Returns the slot for an actor, or INDEX_NONE if it is not a registered target */
+    FORCEINLINE int32 FindSlot(const AActor* Actor) const
+    {
+        const int32* Slot = Actor ? SlotByActor.Find(TObjectKey<AActor>(Actor)) : nullptr;
+        return Slot ? *Slot : INDEX_NONE;
+    }
+
+    /** Returns the querier index for an instigator, or INDEX_NONE */
+    FORCEINLINE int32 FindQuerierIndex(const AActor* Instigator) const
+    {
+        for (int32 Index = 0; Index < QuerierActors.Num(); ++Index)
+        {
+            if (QuerierActors[Index].Get() == Instigator)
+                return Index;
+        }
+        return INDEX_NONE;
+    }
+
+    FORCEINLINE float GetDistance(int32 QuerierIndex, int32 Slot) const
+    {
+        return Distances[QuerierIndex * Num() + Slot];
+    }
+
+    FORCEINLINE float GetBearing(int32 QuerierIndex, int32 Slot) const
+    {
+        return Bearings[QuerierIndex * Num() + Slot];
+    }
+
+    /** Grows the per-target arrays so the given slot is addressable */
+    void EnsureSlotCapacity(int32 SlotCount)
+    {
+        if (SlotCount <= Num())
+            return;
+
+        Actors.SetNum(SlotCount);
+        Occupied.SetNum(SlotCount, false);
+        Locations.SetNumZeroed(SlotCount);
+        Velocities.SetNumZeroed(SlotCount);
+        Forwards.SetNumZeroed(SlotCount);
+        CapsuleRadii.SetNumZeroed(SlotCount);
+        CapsuleHalfHeights.SetNumZeroed(SlotCount);
+        Threats.SetNumZeroed(SlotCount);
+        TeamMasks.SetNumZeroed(SlotCount);
+        SlotGenerations.SetNumZeroed(SlotCount);
+    }
+};
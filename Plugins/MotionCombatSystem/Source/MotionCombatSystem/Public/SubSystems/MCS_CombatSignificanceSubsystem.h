@@ -0,0 +1,139 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_CombatSignificanceSubsystem.h
+ *
+ * Description:
+ *  World subsystem that assigns a combat LOD tier to every registered combat core component based
+ *  on its distance to the nearest player view (off-screen combatants count as farther away).
+ *  Each tier sets hitbox substeps and tick interval, chooser scoring and the targeting refresh
+ *  rate, so background fights cost a fraction of the fight around the camera.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include <Enums/EMCS_CombatLOD.h>
+#include <Structs/MCS_CombatLODSettings.h>
+#include "MCS_CombatSignificanceSubsystem.generated.h"
+
+class UMCS_CombatCoreComponent;
+
+/** One registered combatant and the tier it currently runs at. */
+struct FMCS_CombatSignificanceEntry
+{
+    TWeakObjectPtr<UMCS_CombatCoreComponent> CombatCore;
+    EMCS_CombatLOD LOD = EMCS_CombatLOD::High;
+};
+
+/**
+ * Assigns combat LOD tiers by significance (distance to the nearest view, on/off screen).
+ */
+UCLASS(BlueprintType, Blueprintable, meta = (DisplayName = "Motion Combat Significance Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_CombatSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Constructor
+    UMCS_CombatSignificanceSubsystem();
+
+    /*
+     * Functions
+     */
+
+    /** Starts managing a combatant's LOD (it is evaluated on the next pass and starts at High) */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Significance")
+    void RegisterCombatant(UMCS_CombatCoreComponent* CombatCore);
+
+    /** Stops managing a combatant's LOD */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Significance")
+    void UnregisterCombatant(UMCS_CombatCoreComponent* CombatCore);
+
+    /** Settings of a tier */
+    UFUNCTION(BlueprintPure, Category = "MCS|Significance")
+    const FMCS_CombatLODSettings& GetTierSettings(EMCS_CombatLOD LOD) const;
+
+    /** Re-evaluates every combatant now instead of waiting for the next interval */
+    UFUNCTION(BlueprintCallable, Category = "MCS|Significance")
+    void UpdateSignificance();
+
+    // =========================
+    // WorldSubsystem lifecycle overrides
+    // =========================
+
+    // Only create this subsystem for real game worlds (PIE & Game), not the Editor preview world.
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    /*
+     * Properties
+     */
+
+    /** Seconds between significance passes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Significance", meta = (ClampMin = "0.0"))
+    float EvaluationInterval = 0.25f;
+
+    /** Per-tier settings, indexed by EMCS_CombatLOD (High, Medium, Low, Dormant). The last tier has no distance limit. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, EditFixedSize, Category = "MCS|Significance")
+    TArray<FMCS_CombatLODSettings> TierSettings;
+
+    /** Distance multiplier for combatants outside every view cone */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Significance", meta = (ClampMin = "1.0"))
+    float OffScreenDistanceScale = 2.0f;
+
+    /** Fraction of a tier boundary a combatant must cross before changing tier (prevents flicker at the edges) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Significance", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+    float TierHysteresis = 0.1f;
+
+    /** Enables debug logging of tier changes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Significance|Debug")
+    bool bDebug = false;
+
+private:
+    /** One player view: location, forward and the cosine of the half field of view */
+    struct FViewInfo
+    {
+        FVector Location;
+        FVector Forward;
+        float CosHalfFOV;
+    };
+
+    /*
+     * Properties
+     */
+
+    TArray<FMCS_CombatSignificanceEntry> Combatants;
+
+    /** Views gathered at the start of each pass (reused storage) */
+    TArray<FViewInfo> Views;
+
+    float TimeSinceLastEvaluation = 0.0f;
+
+    /*
+     * Functions
+     */
+
+    /** Fills Views from every player controller's view point (works on clients and servers) */
+    void GatherViews();
+
+    /** Tier for a significance distance, biased by Scale (used for the hysteresis band) */
+    EMCS_CombatLOD ComputeTier(float Distance, float Scale) const;
+
+    /** Pushes a tier's settings to the combatant */
+    void ApplyTier(FMCS_CombatSignificanceEntry& Entry, EMCS_CombatLOD LOD) const;
+};
@@ -0,0 +1,156 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_HitboxSweepSubsystem.h
+ *
+ * Description:
+ *  World subsystem that owns every active hitbox window. Once per frame it asks each detecting
+ *  UMCS_CombatHitboxComponent for its substep sweeps (socket transforms are read once per component),
+ *  runs the whole batch back to back with shared query parameters and result storage, then hands
+ *  each component the hits for its own sweeps. One tick function replaces one per swinging combatant.
+ *
+ *  Hitboxes flagged bAsyncSweep are issued as async scene queries instead; their results are harvested
+ *  at the start of the next frame and dispatched before that frame's synchronous hits, so hits always
+ *  reach listeners in the order their sweeps were issued.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+#include <Structs/MCS_HitboxSweepRequest.h>
+#include <Structs/MCS_HitEvent.h>
+#include <Debug/MCS_HitboxDebugBatch.h>
+#include "MCS_HitboxSweepSubsystem.generated.h"
+
+class UMCS_CombatHitboxComponent;
+struct FMCS_TargetSnapshot;
+
+/** One registered hitbox component and its slice of the current batch. */
+struct FMCS_ActiveHitboxEntry
+{
+    TWeakObjectPtr<UMCS_CombatHitboxComponent> Component;
+
+    /** Time accumulated towards the component's sweep interval (combat LOD) */
+    float TimeSinceSweep = 0.0f;
+
+    /** Requests this component added to the current batch */
+    int32 FirstRequest = 0;
+    int32 NumRequests = 0;
+};
+
+/**
+ * Batches the sweeps of every active hitbox window into one per-frame pass.
+ */
+UCLASS(BlueprintType, meta = (DisplayName = "Motion Combat Hitbox Sweep Subsystem"))
+class MOTIONCOMBATSYSTEM_API UMCS_HitboxSweepSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /*
+     * Functions
+     */
+
+    /** Adds a detecting hitbox component to the batch (called by StartHitDetection) */
+    void RegisterHitbox(UMCS_CombatHitboxComponent* Hitbox);
+
+    /** Removes a hitbox component from the batch (called by StopHitDetection) */
+    void UnregisterHitbox(UMCS_CombatHitboxComponent* Hitbox);
+
+    /** Queues a component whose hits are flushed at the end of this frame's tick (called by ProcessSweepHits) */
+    void QueueHitEventFlush(UMCS_CombatHitboxComponent* Hitbox);
+
+    /** Native: every hit of the frame, across all hitbox components, in one batch after all sweeps */
+    FMCS_OnHitEventsNative OnHitEvents;
+
+    /** Number of hitbox windows currently active */
+    UFUNCTION(BlueprintPure, Category = "MCS|Hitbox")
+    int32 GetNumActiveHitboxes() const { return ActiveHitboxes.Num(); }
+
+    /**
+     * Runs a list of sweeps and appends their hits to OutHits, filling each request's hit range.
+     * Analytic requests test their blade against the targeting snapshot's capsules first, then sweep only world geometry.
+     * Shared by the batch and by components that sweep on their own (no subsystem in the world).
+     */
+    static void RunSweeps(const UWorld* World, TArrayView<FMCS_HitboxSweepRequest> Requests, TArray<FHitResult>& OutHits, FMCS_HitboxSweepScratch& Scratch);
+
+#if MCS_HITBOX_DEBUG_DRAW
+    /** The frame's shared hitbox debug lines, flushed at the end of Tick */
+    FMCS_HitboxDebugBatch& GetDebugBatch() { return DebugBatch; }
+#endif
+
+    // =========================
+    // WorldSubsystem lifecycle overrides
+    // =========================
+
+    // Only create this subsystem for real game worlds (PIE & Game), not the Editor preview world.
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // Only tick while something is swinging or async results are due
+    virtual bool IsTickable() const override { return !ActiveHitboxes.IsEmpty() || !PendingAsyncHitboxes.IsEmpty(); }
+
+private:
+    /*
+     * Properties
+     */
+
+    TArray<FMCS_ActiveHitboxEntry> ActiveHitboxes;
+
+    /** Per-frame batch storage, reused across frames */
+    TArray<FMCS_HitboxSweepRequest> Requests;
+    TArray<FHitResult> Hits;
+    FMCS_HitboxSweepScratch Scratch;
+
+    /** Entries that swept this frame, in gather order (dispatch works on this copy so hit callbacks may start or stop windows) */
+    TArray<FMCS_ActiveHitboxEntry> SweptHitboxes;
+
+    /** Components with queued hits this frame, and the frame-wide batch handed to OnHitEvents */
+    TArray<TWeakObjectPtr<UMCS_CombatHitboxComponent>> HitEventSources;
+    TArray<FMCS_HitEvent> FrameHitEvents;
+
+    /** Async sweeps issued last frame: owners, requests and trace handles (parallel to PendingAsyncRequests) */
+    TArray<FMCS_ActiveHitboxEntry> PendingAsyncHitboxes;
+    TArray<FMCS_HitboxSweepRequest> PendingAsyncRequests;
+    TArray<FTraceHandle> PendingAsyncHandles;
+
+    /** Hits of last frame's async sweeps */
+    TArray<FHitResult> AsyncHits;
+    FTraceDatum AsyncDatum;
+
+#if MCS_HITBOX_DEBUG_DRAW
+    /** Every hitbox's debug lines for this frame */
+    FMCS_HitboxDebugBatch DebugBatch;
+#endif
+
+    /*
+     * Functions
+     */
+
+    /** Reads last frame's async results and dispatches them (must run every frame while any are pending) */
+    void HarvestAsyncSweeps(const UWorld* World);
+
+    /** Broadcasts the frame's hits: the frame-wide batch first, then each component's own */
+    void FlushHitEvents();
+
+    /** Issues one component's requests as async sweeps and remembers them for next frame */
+    void IssueAsyncSweeps(UWorld* World, const FMCS_ActiveHitboxEntry& Entry);
+
+    /** Appends a hit for every snapshot capsule the request's blade touched since the previous substep (no scene query) */
+    static void AppendAnalyticHits(const FMCS_HitboxSweepRequest& Request, const FMCS_TargetSnapshot& Snapshot, TArray<FMCS_CapsuleContact>& Contacts, TArray<FHitResult>& OutHits);
+};
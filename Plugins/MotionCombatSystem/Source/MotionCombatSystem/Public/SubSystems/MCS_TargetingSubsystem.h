@@ -19,6 +19,15 @@
  *  The subsystem scans the environment at set intervals, tracks valid enemies implementing
  *  the UMCS_CombatTargetInterface, and maintains an up-to-date list of nearby targets.
  *
+ *  Targeting is keyed by instigator: every combatant registers as a querier and receives its
+ *  own neighborhood, built from one shared spatial grid over the world's target pool.
+ *
+ *  Target maintenance (validation, distance refresh, candidate filtering) is time-sliced across
+ *  frames under a microsecond budget, so large target counts never produce a single-frame hitch.
+ *
+ *  Every frame the subsystem publishes an FMCS_TargetSnapshot (location, velocity, forward, capsule,
+ *  and distance/bearing to each querier) that all combat consumers read instead of the actors.
+ *
  *  This subsystem exists per-world, not globally, and is recreated when a new level is loaded.
  */
 
@@ -26,12 +35,51 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
 #include <Interfaces/MCS_CombatTargetInterface.h>
 #include <Structs/MCS_TargetInfo.h>
+#include <Structs/MCS_TargetQuerier.h>
+#include <Structs/MCS_TargetSnapshot.h>
+#include <Structs/MCS_TargetPoseHistory.h>
+#include <Structs/MCS_TargetRankingWeights.h>
+#include <Enums/EMCS_TargetCycleDirection.h>
 #include "MCS_TargetingSubsystem.generated.h"
 
 class AActor;
 
+/** Steps of an incremental target maintenance cycle. */
+enum class EMCS_TargetMaintenancePhase : uint8
+{
+	Idle,
+	RefreshTargets,     // Validate pool entries and refresh their distance to the nearest querier
+	FilterCandidates,   // Run interface/targetability checks on overlap results
+	Commit              // Rebuild the grid and neighborhoods, then broadcast
+};
+
+/** Async line-of-sight trace waiting for its result. */
+struct FMCS_PendingVisibilityTrace
+{
+	FTraceHandle Handle;
+	TWeakObjectPtr<AActor> Instigator;
+	TWeakObjectPtr<AActor> Target;
+	int32 TargetSlot = INDEX_NONE;
+};
+
+/** Per-UClass answer to "is this a combat target, and how do we ask it". */
+struct FMCS_TargetClassInfo
+{
+	/** Class implements UMCS_CombatTargetInterface (natively or in Blueprint) */
+	bool bImplementsInterface = false;
+
+	/** CanBeTargeted is implemented in C++ and not overridden in Blueprint, so it can be called directly */
+	bool bNativeCanBeTargeted = false;
+
+	/** Same for GetCombatTeamMask */
+	bool bNativeGetCombatTeamMask = false;
+};
+
 
 /*
  * Delegates
@@ -45,7 +93,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTargetsUpdatedSignature, const T
  * UWorldSubsystem that manages all combat targets within the current world.
  */
 UCLASS(BlueprintType, Blueprintable, meta=(DisplayName = "Motion Combat Targeting Subsystem"))
-class MOTIONCOMBATSYSTEM_API UMCS_TargetingSubsystem : public UWorldSubsystem
+class MOTIONCOMBATSYSTEM_API UMCS_TargetingSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 	
@@ -69,11 +117,116 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
 	const TArray<FMCS_TargetInfo>& GetAllTargets() const { return RegisteredTargets; }
 
-	/** Finds the closest target to the given world position */
+	/**
+	 * Finds the closest target to the given world position.
+	 * Targets must share a bit with IncludeTeamMask (0 = any team) and none with ExcludeTeamMask.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
+	AActor* GetClosestTarget(const FVector& FromLocation, float MaxRange = 2000.0f, float LookaheadTime = 0.0f,
+		int32 IncludeTeamMask = 0, int32 ExcludeTeamMask = 0) const;
+
+	/**
+	 * Registers a combatant that wants its own target neighborhood (players, AI, server-side pawns).
+	 * The team masks filter its neighborhood; registering again only updates them. With bExcludeOwnTeam the
+	 * instigator's own team is excluded too, following later SetTargetTeamMask pushes for the instigator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
+	void RegisterQuerier(AActor* Instigator, int32 IncludeTeamMask = 0, int32 ExcludeTeamMask = 0, bool bExcludeOwnTeam = false);
+
+	/** Changes which teams the instigator may target; neighborhood members it no longer accepts are dropped immediately */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Teams")
+	void SetQuerierTeamFilter(AActor* Instigator, int32 IncludeTeamMask, int32 ExcludeTeamMask, bool bExcludeOwnTeam = false);
+
+	/** Sets how often the instigator's ranking is rescored (combat LOD; 0 = every frame). Membership changes always rescore. */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	void SetQuerierRefreshInterval(AActor* Instigator, float RefreshInterval);
+
+	/** Pushes a target's team/faction bits, replacing the value read from GetCombatTeamMask */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Teams")
+	void SetTargetTeamMask(AActor* TargetActor, int32 TeamMask);
+
+	/**
+	 * Whether the instigator's team filter accepts the target (true for unregistered instigators or targets).
+	 * Lets hit detection ignore allies without another interface call.
+	 */
+	UFUNCTION(BlueprintPure, Category = "MCS|Targeting|Teams")
+	bool IsTeamAllowedForInstigator(const AActor* Instigator, const AActor* TargetActor) const;
+
+	/** Removes a combatant from the querier list */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
+	void UnregisterQuerier(AActor* Instigator);
+
+	/** Returns the targets around the given instigator (empty if it is not a registered querier) */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
+	const TArray<FMCS_TargetInfo>& GetTargetsForInstigator(AActor* Instigator) const;
+
+	/**
+	 * Finds the closest target in the given instigator's neighborhood.
+	 * LookaheadTime > 0 compares where targets will be after that many seconds at their current velocity.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
+	AActor* GetClosestTargetForInstigator(AActor* Instigator, float MaxRange = 2000.0f, float LookaheadTime = 0.0f) const;
+
+	/** Highest-ranked target for the instigator (distance, angle, threat, recency). Reads the ranking cached by Tick; finding the instigator's querier is a scan over the queriers. */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	AActor* GetBestTarget(AActor* Instigator) const;
+
+	/** Fills up to Count targets in ranking order, best first. */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	void GetTopTargets(AActor* Instigator, int32 Count, TArray<AActor*>& OutTargets) const;
+
+	/** Moves the instigator's lock to the next target to the left/right of the current one (locks the best target if none). Uses the cached bearing order; locking checks ranked membership with a scan. */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	AActor* CycleTarget(AActor* Instigator, EMCS_TargetCycleDirection Direction);
+
+	/** Locks the instigator onto a target in its neighborhood (nullptr clears the lock) */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	void SetLockedTarget(AActor* Instigator, AActor* Target);
+
+	/** Returns the instigator's locked target, or nullptr */
+	UFUNCTION(BlueprintPure, Category = "MCS|Targeting|Ranking")
+	AActor* GetLockedTarget(AActor* Instigator) const;
+
+	/** Pushes a target's threat level (clamped to 0-1) used by the ranking */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	void SetTargetThreat(AActor* TargetActor, float Threat);
+
+	/** Records that the instigator just engaged (hit, locked, attacked) the target; feeds the recency term */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|Ranking")
+	void NotifyTargetEngaged(AActor* Instigator, AActor* TargetActor);
+
+	/** Per-frame structure-of-arrays view of every registered target (native consumers only) */
+	const FMCS_TargetSnapshot& GetTargetSnapshot() const { return TargetSnapshot; }
+
+	/**
+	 * Pushes a targetability change so the subsystem no longer polls CanBeTargeted for this actor.
+	 * Untargetable actors leave the pool immediately; targetable ones are picked up by the next scan.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
-	AActor* GetClosestTarget(const FVector& FromLocation, float MaxRange = 2000.0f) const;
+	void NotifyTargetabilityChanged(AActor* TargetActor, bool bCanBeTargeted);
+
+	/** Returns the snapshot slot of a registered target, or INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "MCS|Targeting")
+	int32 FindTargetSlot(const AActor* TargetActor) const { return TargetSnapshot.FindSlot(TargetActor); }
+
+	/**
+	 * Target capsule as it was at a past server world time (UWorld::GetTimeSeconds on the server), interpolated from
+	 * the pose history. False if the target is not registered or the time is outside the recorded history.
+	 */
+	UFUNCTION(BlueprintPure, Category = "MCS|Targeting|LagCompensation")
+	bool GetRewoundTargetCapsule(const AActor* TargetActor, double Time, FVector& OutCenter, float& OutRadius, float& OutHalfHeight) const;
+
+	/**
+	 * Server-side check of a client-reported melee hit. Rewinds the target to ViewTime and tests the reported blade
+	 * segment against that capsule analytically. ViewTime must be in server world time as seen by the client: the
+	 * client's AGameStateBase::GetServerWorldTimeSeconds() minus its interpolation delay for remote characters, not
+	 * its local world time. Tolerance pads the blade radius for interpolation and quantization error. Fails for view
+	 * times older than MaxRewindTime.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting|LagCompensation")
+	bool ValidateRewoundHit(const AActor* TargetActor, double ViewTime, const FVector& BladeStart, const FVector& BladeEnd, float BladeRadius, float Tolerance = 5.0f) const;
 
-	/** Manually triggers a target scan (if you want to force-update) */
+	/** Manually triggers a target scan (if you want to force-update). Runs a full cycle immediately, ignoring the frame budget. */
 	UFUNCTION(BlueprintCallable, Category = "MCS|Targeting")
 	void ScanForTargets();
 
@@ -96,6 +249,10 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// Drives the time-sliced maintenance cycle
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	/*
 	 * Properties
 	*/
@@ -109,18 +266,108 @@ protected:
 	 * Properties
 	 */
 	
-	 /** How often to scan for targets (in seconds). Higher = less frequent. */
+	 /** How often to scan for targets (in seconds) while queriers move at a normal pace. Higher = less frequent. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance")
 	float TargetScanInterval = 1.0f;
 
-	/** Maximum distance to detect potential targets */
+	/** Adapt the scan interval to querier speed, distance travelled and attack state instead of a fixed timer */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance")
+	bool bAdaptiveScanInterval = true;
+
+	/** Shortest interval between scans (fast movement or mid-attack) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (EditCondition = "bAdaptiveScanInterval", ClampMin = "0.0"))
+	float MinTargetScanInterval = 0.15f;
+
+	/** Longest interval between scans while every querier stands still */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (EditCondition = "bAdaptiveScanInterval", ClampMin = "0.0"))
+	float MaxTargetScanInterval = 3.0f;
+
+	/** Querier speed (units/s) at which the interval reaches MinTargetScanInterval */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (EditCondition = "bAdaptiveScanInterval", ClampMin = "1.0"))
+	float ScanReferenceSpeed = 800.0f;
+
+	/** Querier speed (units/s) below which it counts as idle */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (EditCondition = "bAdaptiveScanInterval", ClampMin = "0.0"))
+	float IdleSpeedThreshold = 10.0f;
+
+	/** Fraction of ScanRadius a querier may travel before a scan is forced (after MinTargetScanInterval) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (EditCondition = "bAdaptiveScanInterval", ClampMin = "0.0", ClampMax = "1.0"))
+	float RescanDistanceFraction = 0.2f;
+
+	/** Time budget per frame for target maintenance (microseconds). Work that does not fit continues next frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (ClampMin = "1.0"))
+	float MaintenanceBudgetMicroseconds = 200.0f;
+
+	/** Minimum items processed per frame regardless of budget, so a cycle always makes progress */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Performance", meta = (ClampMin = "1"))
+	int32 MinMaintenanceSliceSize = 4;
+
+	/** Maximum distance to detect potential targets (enter radius) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Detection")
 	float ScanRadius = 2500.0f;
 
-	/** List of registered target info structs */
+	/** Distance at which a tracked target is dropped again. Values below ScanRadius behave like ScanRadius. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Detection")
+	float ExitRadius = 2750.0f;
+
+	/** Minimum time (seconds) a target stays tracked after entering, even if it leaves ExitRadius. 0 = off. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Detection", meta = (ClampMin = "0.0"))
+	float MinResidencyTime = 0.5f;
+
+	/**
+	 * Object types returned by the scan overlap. Leave empty to use the plugin's "CombatTarget" channel
+	 * (all dynamic objects if the project does not define it).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Detection")
+	TArray<TEnumAsByte<EObjectTypeQuery>> TargetObjectTypes;
+
+	/** Optional collision profile used for the scan overlap instead of TargetObjectTypes (e.g. "MCS_CombatTargetScan") */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Detection")
+	FName ScanQueryProfile = NAME_None;
+
+	/** Name of the object channel target actors are expected to use (see Config/DefaultEngine.ini) */
+	static const FName CombatTargetChannelName;
+
+	/** List of registered target info structs (world-level pool shared by every querier) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Targeting")
 	TArray<FMCS_TargetInfo> RegisteredTargets;
 
+	/** Combatants asking for targets, each with its own neighborhood */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MCS|Targeting")
+	TArray<FMCS_TargetQuerier> Queriers;
+
+	/** Weights of the per-instigator target ranking used by GetBestTarget, CycleTarget and GetTopTargets */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Ranking")
+	FMCS_TargetRankingWeights RankingWeights;
+
+	/** Trace line of sight from every querier to its neighborhood and expose the result in FMCS_TargetInfo */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Visibility")
+	bool bEnableLineOfSight = false;
+
+	/** Channel used for line-of-sight traces */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Visibility", meta = (EditCondition = "bEnableLineOfSight"))
+	TEnumAsByte<ECollisionChannel> LineOfSightChannel = ECC_Visibility;
+
+	/** Maximum async line-of-sight traces issued per frame (round-robin over all querier/target pairs) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Visibility", meta = (EditCondition = "bEnableLineOfSight", ClampMin = "1"))
+	int32 MaxLineOfSightTracesPerFrame = 8;
+
+	/** A pair is not re-traced until its cached result is at least this old (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Visibility", meta = (EditCondition = "bEnableLineOfSight", ClampMin = "0.0"))
+	float LineOfSightRefreshInterval = 0.2f;
+
+	/** Record target capsules every frame so client-reported hits can be validated at the client's view time (not on clients) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|LagCompensation")
+	bool bRecordPoseHistory = true;
+
+	/** Frames of pose history kept (32 frames ≈ 0.5 s at 60 Hz) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "MCS|Targeting|LagCompensation", meta = (EditCondition = "bRecordPoseHistory", ClampMin = "2"))
+	int32 PoseHistoryFrames = 32;
+
+	/** Oldest view time (seconds behind now) a client hit may be validated at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|LagCompensation", meta = (EditCondition = "bRecordPoseHistory", ClampMin = "0.0"))
+	float MaxRewindTime = 0.4f;
+
 	/** Whether to draw debug visuals for targeting */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MCS|Targeting|Debug")
 	bool bDebug = false;
@@ -140,8 +387,24 @@ private:
 	/** Cached reference to the world that owns this subsystem */
 	TObjectPtr<UWorld> CachedWorld;
 
-	/** Timer handle for recurring scans */
-	FTimerHandle ScanTimerHandle;
+	/** Object channel named CombatTargetChannelName, or ECC_MAX if the project does not define it */
+	TEnumAsByte<ECollisionChannel> CombatTargetChannel = ECC_MAX;
+
+	/** Time accumulated since the last maintenance cycle finished */
+	float TimeSinceLastScan = 0.0f;
+
+	/** Current step of the maintenance cycle */
+	EMCS_TargetMaintenancePhase MaintenancePhase = EMCS_TargetMaintenancePhase::Idle;
+
+	/** Index of the next item to process in the current phase */
+	int32 MaintenanceCursor = 0;
+
+	/** Querier locations captured when the cycle started */
+	TArray<FVector> CycleQuerierLocations;
+
+	/** Overlap results waiting for the FilterCandidates phase */
+	TArray<TWeakObjectPtr<AActor>> PendingCandidates;
+
 
 	// Handy label we’ll use in logs so we can see which world is speaking.
 	FString MakeWorldTag() const;
@@ -151,12 +414,154 @@ private:
 
 	/** Whether target scanning is currently active */
 	bool bIsScanningEnabled = true;
+
+	/** Uniform XY grid over RegisteredTargets (cell size = ScanRadius), rebuilt once per scan */
+	TMap<FIntPoint, TArray<int32>> TargetGrid;
+
+	/** Per-frame target snapshot shared by every combat consumer */
+	FMCS_TargetSnapshot TargetSnapshot;
+
+	/** Timestamped snapshot capsules for lag-compensated hit validation */
+	FMCS_TargetPoseHistory PoseHistory;
+
+	/** Interface/override lookup cached per actor class */
+	TMap<TWeakObjectPtr<const UClass>, FMCS_TargetClassInfo> TargetClassCache;
+
+	/** Last targetability pushed through NotifyTargetabilityChanged; these actors are never polled */
+	TMap<TObjectKey<AActor>, bool> PushedTargetability;
+
+	/** Team masks pushed through SetTargetTeamMask; these override GetCombatTeamMask */
+	TMap<TObjectKey<AActor>, int32> PushedTeamMasks;
+
+	/** Line-of-sight traces issued last frame, harvested in order */
+	TArray<FMCS_PendingVisibilityTrace> PendingVisibilityTraces;
+
+	/** Round-robin position of the line-of-sight stage (querier index, neighborhood index) */
+	int32 VisibilityQuerierCursor = 0;
+	int32 VisibilityEntryCursor = 0;
+
+	/** Released snapshot slots ready for reuse */
+	TArray<int32> FreeTargetSlots;
+
+	/** Map key per slot, kept so slots can be released after their actor was garbage collected */
+	TArray<TObjectKey<AActor>> SlotKeys;
 	
 	/*
 	 * Functions
 	*/
 
-	/** Removes any targets that are valid but have moved beyond the current ScanRadius */
-	void RemoveOutOfRangeTargets(const FVector& FromLocation);
+	/** Returns true when the next maintenance cycle should start, based on elapsed time and querier activity */
+	bool ShouldBeginMaintenanceCycle() const;
+
+	/** Gathers queriers and overlap candidates, then enters the first maintenance phase */
+	void BeginMaintenanceCycle();
+
+	/** Processes maintenance items until the budget runs out (BudgetSeconds < 0 = run to completion) */
+	void AdvanceMaintenance(double BudgetSeconds);
+
+	/** Validates one pool entry and refreshes its distance. Returns false if the entry was removed. */
+	bool RefreshTargetAt(int32 Index);
+
+	/** Runs the interface/targetability/range checks on one overlap candidate */
+	void FilterCandidate(AActor* Actor);
+
+	/** Rebuilds the grid and neighborhoods and broadcasts the result */
+	void CommitMaintenanceCycle();
+
+	/** Returns the squared distance from a location to the nearest cycle querier */
+	float GetNearestQuerierDistanceSq(const FVector& Location) const;
+
+	/** Registers local player pawns when nothing else asked for targets (keeps Blueprint-only setups working) */
+	void RegisterLocalPlayerQueriers();
+
+	/** Drops queriers whose instigator is gone and fills the current location of the rest */
+	void GatherQuerierLocations(TArray<FVector>& OutLocations);
+
+	/** Looks up CombatTargetChannel by name in the project's collision settings */
+	void ResolveCombatTargetChannel();
+
+	/** Object types for the scan: TargetObjectTypes, else CombatTarget, else all dynamic objects */
+	FCollisionObjectQueryParams MakeScanObjectQueryParams() const;
+
+	/** Runs one overlap per cluster of nearby queriers and returns the unique actors found */
+	void GatherCandidates(UWorld* World, const TArray<FVector>& QuerierLocations, TArray<AActor*>& OutCandidates) const;
+
+	/** Rebuilds TargetGrid from RegisteredTargets using snapshot locations */
+	void RebuildTargetGrid();
+
+	/** Appends the RegisteredTargets indices stored in grid cells touching the given sphere */
+	void QueryTargetGrid(const FVector& Center, float Radius, TArray<int32>& OutIndices) const;
+
+	/** Rebuilds every querier's neighborhood from the grid */
+	void BuildNeighborhoods(const TArray<FVector>& QuerierLocations);
+
+	/** Returns the grid cell containing the given location */
+	FIntPoint GetGridCell(const FVector& Location) const;
+
+	/** Returns the querier entry for an instigator, or nullptr */
+	const FMCS_TargetQuerier* FindQuerier(const AActor* Instigator) const;
+
+	/** Returns the cached interface info for an actor's class, building it on first use */
+	const FMCS_TargetClassInfo& GetTargetClassInfo(const UClass* ActorClass);
+
+	/** Pushed targetability if any, otherwise a direct or Blueprint CanBeTargeted call */
+	bool QueryCanBeTargeted(AActor* Actor, const FMCS_TargetClassInfo& ClassInfo) const;
+
+	/** Pushed team mask if any, otherwise a direct or Blueprint GetCombatTeamMask call */
+	int32 QueryTeamMask(AActor* Actor, const FMCS_TargetClassInfo& ClassInfo) const;
+
+	/** Whether at least one querier's team filter accepts the mask (pool entries nobody can target are not kept) */
+	bool IsTeamWantedByAnyQuerier(int32 TeamMask) const;
+
+	/** Drops neighborhood members the querier's current team filter rejects (accepted teams join on the next scan) */
+	void DropRejectedNeighbors(FMCS_TargetQuerier& Querier);
+
+	/** Effective exit radius (never smaller than ScanRadius) */
+	float GetExitRadius() const { return FMath::Max(ScanRadius, ExitRadius); }
+
+	/** Whether an entry that joined at EnteredTime is still inside its minimum residency window */
+	bool IsWithinResidency(float EnteredTime, float Now) const { return MinResidencyTime > 0.0f && Now - EnteredTime < MinResidencyTime; }
+
+	/** Current world time in seconds (0 without a world) */
+	float GetWorldTimeSeconds() const;
+
+	/** Adds an actor to RegisteredTargets with a fresh snapshot slot */
+	void AddTargetToPool(AActor* TargetActor, float Distance, int32 TeamMask);
+
+	/** Frees the snapshot slot of a pool entry that is about to be removed */
+	void ReleaseTargetSlot(const FMCS_TargetInfo& Info);
+
+	/** Removes a pool entry by swapping with the tail, keeping a time-sliced refresh pass from skipping or repeating entries */
+	void RemoveTargetAt(int32 Index);
+
+	/** Captures one target's transform, velocity and capsule into its snapshot slot */
+	void WriteSnapshotSlot(int32 Slot, const AActor* TargetActor);
+
+	/** Refreshes the whole snapshot and the DistanceFromPlayer of every pool and neighborhood entry */
+	void RefreshSnapshot();
+
+	/** Stores finished line-of-sight traces into each querier's visibility cache */
+	void CollectVisibilityTraces();
+
+	/** Issues up to MaxLineOfSightTracesPerFrame async traces, continuing where the last frame stopped */
+	void DispatchVisibilityTraces();
+
+	/** Grows a querier's per-slot caches (visibility, ranking, recency) to cover every snapshot slot */
+	void EnsureQuerierSlotCapacity(FMCS_TargetQuerier& Querier) const;
+
+	/** Rescores every querier's neighborhood from the snapshot and re-sorts the ranked/bearing orders */
+	void UpdateRankings();
+
+	/** Returns the querier entry for an instigator, or nullptr */
+	FMCS_TargetQuerier* FindQuerierMutable(const AActor* Instigator);
+
+	/** Whether a slot is live and still owned by the given actor */
+	bool IsSlotOwnedBy(int32 Slot, const AActor* Actor) const;
+
+	/** Broadcasts OnTargetsUpdated if the target count changed since the last broadcast */
+	void BroadcastIfTargetCountChanged();
+
+	/** Notifies the combat core of every querier whose neighborhood membership changed, once per frame */
+	void BroadcastNeighborhoodChanges();
 
 };
@@ -0,0 +1,322 @@
+/*
+ * ========================================================================
+ * Copyright © 2025 God's Studio
+ * All Rights Reserved.
+ *
+ * Free for all to use, copy, and distribute. I hope you learn from this as I learned creating it.
+ * =============================================================================
+ *
+ * Project: Motion Combat System
+ * This is a combat system inspired by Unreal Engine’s Motion Matching plugin.
+ * Author: Christopher D. Parker
+ * Date: 10-18-2025
+ * =============================================================================
+ * MCS_CombatMath.h
+ * Geometry helpers for physics-free hit detection: closest points between segments and triangles,
+ * and blade segments (or the surface a blade swept between two substeps) tested against the
+ * upright character capsules of the target snapshot.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** A blade segment touching one target capsule */
+struct FMCS_CapsuleContact
+{
+    /** Target slot of the capsule (FMCS_TargetSnapshot) */
+    int32 Slot = INDEX_NONE;
+
+    /** Closest point on the blade and the contact point on the capsule surface */
+    FVector BladePoint = FVector::ZeroVector;
+    FVector SurfacePoint = FVector::ZeroVector;
+
+    /** Capsule surface normal at the contact (points toward the blade) */
+    FVector Normal = FVector::UpVector;
+
+    /** Position of BladePoint along the blade, start = 0, end = 1 */
+    float BladeAlpha = 0.0f;
+};
+
+namespace MCS_CombatMath
+{
+    /**
+     * Closest points between segments [P0, P1] and [Q0, Q1] (Ericson, Real-Time Collision Detection 5.1.9).
+     * Returns the squared distance; OutS/OutT are the parameters of the closest points along each segment.
+     */
+    inline float ClosestPointsSegmentSegment(const FVector& P0, const FVector& P1, const FVector& Q0, const FVector& Q1, float& OutS, float& OutT)
+    {
+        const FVector D1 = P1 - P0;
+        const FVector D2 = Q1 - Q0;
+        const FVector R = P0 - Q0;
+        const float A = D1.SizeSquared();
+        const float E = D2.SizeSquared();
+        const float F = FVector::DotProduct(D2, R);
+
+        if (A <= UE_SMALL_NUMBER && E <= UE_SMALL_NUMBER)
+        {
+            OutS = OutT = 0.0f;
+        }
+        else if (A <= UE_SMALL_NUMBER)
+        {
+            OutS = 0.0f;
+            OutT = FMath::Clamp(F / E, 0.0f, 1.0f);
+        }
+        else
+        {
+            const float C = FVector::DotProduct(D1, R);
+            if (E <= UE_SMALL_NUMBER)
+            {
+                OutT = 0.0f;
+                OutS = FMath::Clamp(-C / A, 0.0f, 1.0f);
+            }
+            else
+            {
+                // Parallel segments (Denom == 0) pick S = 0 and let T find the closest point
+                const float B = FVector::DotProduct(D1, D2);
+                const float Denom = A * E - B * B;
+                OutS = Denom > UE_SMALL_NUMBER ? FMath::Clamp((B * F - C * E) / Denom, 0.0f, 1.0f) : 0.0f;
+                OutT = (B * OutS + F) / E;
+
+                if (OutT < 0.0f)
+                {
+                    OutT = 0.0f;
+                    OutS = FMath::Clamp(-C / A, 0.0f, 1.0f);
+                }
+                else if (OutT > 1.0f)
+                {
+                    OutT = 1.0f;
+                    OutS = FMath::Clamp((B - C) / A, 0.0f, 1.0f);
+                }
+            }
+        }
+
+        return FVector::DistSquared(P0 + D1 * OutS, Q0 + D2 * OutT);
+    }
+
+    /** Closest point on triangle ABC to P (Ericson, Real-Time Collision Detection 5.1.5) */
+    inline FVector ClosestPointOnTriangle(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+    {
+        const FVector AB = B - A;
+        const FVector AC = C - A;
+        const FVector AP = P - A;
+        const float D1 = FVector::DotProduct(AB, AP);
+        const float D2 = FVector::DotProduct(AC, AP);
+        if (D1 <= 0.0f && D2 <= 0.0f)
+            return A;
+
+        const FVector BP = P - B;
+        const float D3 = FVector::DotProduct(AB, BP);
+        const float D4 = FVector::DotProduct(AC, BP);
+        if (D3 >= 0.0f && D4 <= D3)
+            return B;
+
+        const float VC = D1 * D4 - D3 * D2;
+        if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+            return A + AB * (D1 / (D1 - D3));
+
+        const FVector CP = P - C;
+        const float D5 = FVector::DotProduct(AB, CP);
+        const float D6 = FVector::DotProduct(AC, CP);
+        if (D6 >= 0.0f && D5 <= D6)
+            return C;
+
+        const float VB = D5 * D2 - D1 * D6;
+        if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+            return A + AC * (D2 / (D2 - D6));
+
+        const float VA = D3 * D6 - D5 * D4;
+        if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+            return B + (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)));
+
+        // Inside the face (a degenerate triangle never gets here with a usable denominator; its edges cover it)
+        const float Denom = VA + VB + VC;
+        if (Denom <= UE_SMALL_NUMBER)
+            return A;
+
+        return A + AB * (VB / Denom) + AC * (VC / Denom);
+    }
+
+    /**
+     * Squared distance between segment [P0, P1] and triangle ABC, with the closest point on each.
+     * Zero when the segment crosses the triangle; otherwise the minimum over the triangle's edges and the segment's endpoints.
+     */
+    inline float SegmentTriangleDistSq(const FVector& P0, const FVector& P1, const FVector& A, const FVector& B, const FVector& C, FVector& OutSegmentPoint, FVector& OutTrianglePoint)
+    {
+        // Degenerate triangles (a blade that did not move, or has no length) skip the face test; their edges cover them
+        FVector Crossing, TriangleNormal;
+        if (FVector::CrossProduct(B - A, C - A).SizeSquared() > UE_KINDA_SMALL_NUMBER
+            && FMath::SegmentTriangleIntersection(P0, P1, A, B, C, Crossing, TriangleNormal))
+        {
+            OutSegmentPoint = OutTrianglePoint = Crossing;
+            return 0.0f;
+        }
+
+        float BestDistSq = TNumericLimits<float>::Max();
+        auto TryEdge = [ & ] (const FVector& Q0, const FVector& Q1)
+            {
+                float S, T;
+                const float DistSq = ClosestPointsSegmentSegment(P0, P1, Q0, Q1, S, T);
+                if (DistSq < BestDistSq)
+                {
+                    BestDistSq = DistSq;
+                    OutSegmentPoint = FMath::Lerp(P0, P1, S);
+                    OutTrianglePoint = FMath::Lerp(Q0, Q1, T);
+                }
+            };
+        auto TryEndpoint = [ & ] (const FVector& P)
+            {
+                const FVector OnTriangle = ClosestPointOnTriangle(P, A, B, C);
+                const float DistSq = FVector::DistSquared(P, OnTriangle);
+                if (DistSq < BestDistSq)
+                {
+                    BestDistSq = DistSq;
+                    OutSegmentPoint = P;
+                    OutTrianglePoint = OnTriangle;
+                }
+            };
+
+        TryEdge(A, B);
+        TryEdge(B, C);
+        TryEdge(C, A);
+        TryEndpoint(P0);
+        TryEndpoint(P1);
+        return BestDistSq;
+    }
+
+    /** Fills a contact from the closest blade and capsule-axis points; a blade through the axis pushes out toward the blade center */
+    inline void MakeCapsuleContact(const FVector& BladePoint, const FVector& AxisPoint, const FVector& BladeCenter, const FVector& Center, float Radius, float BladeAlpha, FMCS_CapsuleContact& OutContact)
+    {
+        FVector Normal = (BladePoint - AxisPoint).GetSafeNormal();
+        if (Normal.IsNearlyZero())
+        {
+            Normal = (BladeCenter - Center).GetSafeNormal2D();
+            if (Normal.IsNearlyZero())
+            {
+                Normal = FVector::ForwardVector;
+            }
+        }
+
+        OutContact.BladePoint = BladePoint;
+        OutContact.SurfacePoint = AxisPoint + Normal * Radius;
+        OutContact.Normal = Normal;
+        OutContact.BladeAlpha = BladeAlpha;
+    }
+
+    /**
+     * Tests a blade segment of the given radius against one upright capsule (axis along Z, HalfHeight includes the caps).
+     * Fills OutContact (Slot is left untouched) and returns true on overlap.
+     */
+    inline bool BladeVsUprightCapsule(
+        const FVector& BladeStart,
+        const FVector& BladeEnd,
+        float BladeRadius,
+        const FVector& Center,
+        float Radius,
+        float HalfHeight,
+        FMCS_CapsuleContact& OutContact)
+    {
+        // Capsule axis runs between the centers of its two hemispheres
+        const FVector AxisOffset(0.0f, 0.0f, FMath::Max(HalfHeight, Radius) - Radius);
+        const FVector AxisBottom = Center - AxisOffset;
+        const FVector AxisTop = Center + AxisOffset;
+
+        float S, T;
+        const float DistSq = ClosestPointsSegmentSegment(BladeStart, BladeEnd, AxisBottom, AxisTop, S, T);
+        if (DistSq > FMath::Square(BladeRadius + Radius))
+            return false;
+
+        MakeCapsuleContact(FMath::Lerp(BladeStart, BladeEnd, S), FMath::Lerp(AxisBottom, AxisTop, T), 0.5f * (BladeStart + BladeEnd), Center, Radius, S, OutContact);
+        return true;
+    }
+
+    /**
+     * Tests the surface a blade swept from [LastStart, LastEnd] to [BladeStart, BladeEnd] against one upright capsule,
+     * so a blade that moved clean through a thin capsule between substeps still hits it. The quad is split into two
+     * triangles. BladeAlpha is the contact's position along the current blade.
+     */
+    inline bool SweptBladeVsUprightCapsule(
+        const FVector& LastStart,
+        const FVector& LastEnd,
+        const FVector& BladeStart,
+        const FVector& BladeEnd,
+        float BladeRadius,
+        const FVector& Center,
+        float Radius,
+        float HalfHeight,
+        FMCS_CapsuleContact& OutContact)
+    {
+        // No motion since the last substep: the plain segment test is exact and cheaper
+        if (FVector::DistSquared(LastStart, BladeStart) + FVector::DistSquared(LastEnd, BladeEnd) <= UE_KINDA_SMALL_NUMBER)
+            return BladeVsUprightCapsule(BladeStart, BladeEnd, BladeRadius, Center, Radius, HalfHeight, OutContact);
+
+        const FVector AxisOffset(0.0f, 0.0f, FMath::Max(HalfHeight, Radius) - Radius);
+        const FVector AxisBottom = Center - AxisOffset;
+        const FVector AxisTop = Center + AxisOffset;
+
+        FVector AxisPoint, BladePoint;
+        float DistSq = SegmentTriangleDistSq(AxisBottom, AxisTop, LastStart, LastEnd, BladeEnd, AxisPoint, BladePoint);
+
+        FVector OtherAxisPoint, OtherBladePoint;
+        const float OtherDistSq = SegmentTriangleDistSq(AxisBottom, AxisTop, LastStart, BladeEnd, BladeStart, OtherAxisPoint, OtherBladePoint);
+        if (OtherDistSq < DistSq)
+        {
+            DistSq = OtherDistSq;
+            AxisPoint = OtherAxisPoint;
+            BladePoint = OtherBladePoint;
+        }
+
+        if (DistSq > FMath::Square(BladeRadius + Radius))
+            return false;
+
+        const FVector BladeDir = BladeEnd - BladeStart;
+        const float BladeLengthSq = BladeDir.SizeSquared();
+        const float BladeAlpha = BladeLengthSq > UE_SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(BladePoint - BladeStart, BladeDir) / BladeLengthSq, 0.0f, 1.0f) : 0.0f;
+
+        MakeCapsuleContact(BladePoint, AxisPoint, 0.5f * (BladeStart + BladeEnd), Center, Radius, BladeAlpha, OutContact);
+        return true;
+    }
+
+    /**
+     * Tests the surface a blade of the given radius swept since the last substep against every occupied upright capsule
+     * in structure-of-arrays form (centers, radii and half heights indexed by slot, as in FMCS_TargetSnapshot) and appends
+     * one contact per overlap. A plain scalar loop; a bounding-sphere test around the swept quad rejects most slots
+     * before the triangle math runs.
+     */
+    inline void BladeVsUprightCapsules(
+        const FVector& LastStart,
+        const FVector& LastEnd,
+        const FVector& BladeStart,
+        const FVector& BladeEnd,
+        float BladeRadius,
+        TConstArrayView<FVector> Centers,
+        TConstArrayView<float> Radii,
+        TConstArrayView<float> HalfHeights,
+        const TBitArray<>& Occupied,
+        TArray<FMCS_CapsuleContact>& OutContacts)
+    {
+        const FVector BladeCenter = 0.25f * (LastStart + LastEnd + BladeStart + BladeEnd);
+        const float BladeExtent = FMath::Sqrt(FMath::Max(
+            FMath::Max(FVector::DistSquared(BladeCenter, LastStart), FVector::DistSquared(BladeCenter, LastEnd)),
+            FMath::Max(FVector::DistSquared(BladeCenter, BladeStart), FVector::DistSquared(BladeCenter, BladeEnd)))) + BladeRadius;
+
+        for (TConstSetBitIterator<> It(Occupied); It; ++It)
+        {
+            const int32 Slot = It.GetIndex();
+            const FVector& Center = Centers[Slot];
+            const float Radius = Radii[Slot];
+            const float HalfHeight = FMath::Max(HalfHeights[Slot], Radius);
+
+            // Bounding spheres first: cheap, and it rejects nearly everything
+            if (FVector::DistSquared(BladeCenter, Center) > FMath::Square(BladeExtent + HalfHeight))
+                continue;
+
+            FMCS_CapsuleContact Contact;
+            if (SweptBladeVsUprightCapsule(LastStart, LastEnd, BladeStart, BladeEnd, BladeRadius, Center, Radius, HalfHeight, Contact))
+            {
+                Contact.Slot = Slot;
+                OutContacts.Add(Contact);
+            }
+        }
+    }
+}